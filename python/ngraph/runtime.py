@@ -15,7 +15,7 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
-from typing import List, Union
+from typing import List, Optional, Union
 
 import numpy as np
 
@@ -74,29 +74,43 @@ class Computation(object):
             element_type = parameter.get_element_type()
             self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
 
+        # Result tensors are allocated once and reused by every call
+        self.result_views = []  # type: List[TensorView]
+        for i in range(ng_function.get_output_size()):
+            shape = ng_function.get_output_shape(i)
+            element_type = ng_function.get_output_element_type(i)
+            self.result_views.append(runtime.backend.create_tensor(element_type, shape))
+
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
-    def __call__(self, *input_values):  # type: (*NumericData) -> NumericData
-        """Run computation on input values and return result."""
+    def __call__(self, *input_values):
+        # type: (*NumericData) -> Union[np.ndarray, List[np.ndarray]]
+        """Run computation on input values and return result.
+
+        Inputs of matching type and shape are passed to the backend without a copy. Results are
+        returned as views of the computation's output tensors where the backend allows it, so
+        they are overwritten by the next call; copy them to keep them.
+
+        :return: the result array, or a list of result arrays if the function has several outputs
+        """
+        input_views = []  # type: List[TensorView]
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
-
-        result_element_type = self.function.get_output_element_type(0)
-        result_shape = self.function.get_output_shape(0)
-        result_dtype = get_dtype(result_element_type)
+            input_view = self._wrap_ndarray(value, tensor_view)
+            if input_view is None:
+                Computation._write_ndarray_to_tensor_view(value, tensor_view)
+                input_view = tensor_view
+            input_views.append(input_view)
 
-        result_view = self.runtime.backend.create_tensor(result_element_type, result_shape)
-        result_arr = np.empty(result_shape, dtype=result_dtype)
+        self.runtime.backend.call(self.function, self.result_views, input_views)
 
-        self.runtime.backend.call(self.function, [result_view], self.tensor_views)
-
-        Computation._read_tensor_view_to_ndarray(result_view, result_arr)
-        result_arr = result_arr.reshape(result_shape)
-        return result_arr
+        results = [Computation._tensor_view_to_ndarray(view) for view in self.result_views]
+        if len(results) == 1:
+            return results[0]
+        return results
 
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
@@ -130,6 +144,27 @@ class Computation(object):
         nparray = np.ascontiguousarray(value)
         tensor_view.write(util.numpy_to_c(nparray), 0, buffer_size)
 
+    def _wrap_ndarray(self, value, tensor_view):
+        # type: (np.ndarray, TensorView) -> Optional[TensorView]
+        """Return a tensor sharing the memory of value, or None if a copy is needed."""
+        if (value.dtype != get_dtype(tensor_view.element_type) or
+                list(value.shape) != list(tensor_view.shape) or
+                not value.flags['C_CONTIGUOUS'] or not value.flags['WRITEABLE']):
+            return None
+        input_view = self.runtime.backend.create_tensor(tensor_view.element_type,
+                                                        tensor_view.shape, value)
+        if not input_view.host_accessible:
+            return None
+        return input_view
+
+    @staticmethod
+    def _tensor_view_to_ndarray(tensor_view):  # type: (TensorView) -> np.ndarray
+        if tensor_view.host_accessible:
+            return np.asarray(tensor_view)
+        output = np.empty(tensor_view.shape, dtype=get_dtype(tensor_view.element_type))
+        Computation._read_tensor_view_to_ndarray(tensor_view, output)
+        return output
+
     @staticmethod
     def _read_tensor_view_to_ndarray(tensor_view, output):
         # type: (TensorView, np.ndarray) -> None
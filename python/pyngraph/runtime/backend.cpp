@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -34,6 +35,29 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::TensorView>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // Wrap the memory of a C-contiguous array without copying it. The tensor keeps the array
+    // alive; backends without host-accessible tensors report host_accessible == False.
+    backend.def("create_tensor",
+                [](ngraph::runtime::Backend& self,
+                   const ngraph::element::Type& element_type,
+                   const ngraph::Shape& shape,
+                   py::array array) {
+                    if (!(array.flags() & py::array::c_style))
+                    {
+                        throw std::invalid_argument("Array must be C-contiguous");
+                    }
+                    if (!array.writeable())
+                    {
+                        throw std::invalid_argument("Array must be writeable");
+                    }
+                    if (static_cast<size_t>(array.nbytes()) !=
+                        ngraph::shape_size(shape) * element_type.size())
+                    {
+                        throw std::invalid_argument("Array size does not match the tensor size");
+                    }
+                    return self.create_tensor(element_type, shape, array.mutable_data());
+                },
+                py::keep_alive<0, 4>());
     backend.def("compile",
                 (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
                     ngraph::runtime::Backend::compile);
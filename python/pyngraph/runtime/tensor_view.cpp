@@ -17,21 +17,100 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include "ngraph/type/element_type.hpp"
+
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 #include "pyngraph/runtime/tensor_view.hpp"
 
 namespace py = pybind11;
 
+namespace
+{
+    // Buffer protocol format character of an element type
+    std::string get_buffer_format(const ngraph::element::Type& type)
+    {
+        if (type == ngraph::element::boolean)
+        {
+            return "?";
+        }
+        else if (type == ngraph::element::f32)
+        {
+            return py::format_descriptor<float>::format();
+        }
+        else if (type == ngraph::element::f64)
+        {
+            return py::format_descriptor<double>::format();
+        }
+        else if (type == ngraph::element::i8)
+        {
+            return py::format_descriptor<int8_t>::format();
+        }
+        else if (type == ngraph::element::i16)
+        {
+            return py::format_descriptor<int16_t>::format();
+        }
+        else if (type == ngraph::element::i32)
+        {
+            return py::format_descriptor<int32_t>::format();
+        }
+        else if (type == ngraph::element::i64)
+        {
+            return py::format_descriptor<int64_t>::format();
+        }
+        else if (type == ngraph::element::u8)
+        {
+            return py::format_descriptor<uint8_t>::format();
+        }
+        else if (type == ngraph::element::u16)
+        {
+            return py::format_descriptor<uint16_t>::format();
+        }
+        else if (type == ngraph::element::u32)
+        {
+            return py::format_descriptor<uint32_t>::format();
+        }
+        else if (type == ngraph::element::u64)
+        {
+            return py::format_descriptor<uint64_t>::format();
+        }
+        throw py::buffer_error("Unsupported element type " + type.c_type_string());
+    }
+}
+
 void regclass_pyngraph_runtime_TensorView(py::module m)
 {
     py::class_<ngraph::runtime::TensorView, std::shared_ptr<ngraph::runtime::TensorView>>
-        tensorView(m, "TensorView");
+        tensorView(m, "TensorView", py::buffer_protocol());
     tensorView.doc() = "ngraph.impl.runtime.TensorView wraps ngraph::runtime::TensorView";
     tensorView.def("write",
                    (void (ngraph::runtime::TensorView::*)(const void*, size_t, size_t)) &
                        ngraph::runtime::TensorView::write);
     tensorView.def("read", &ngraph::runtime::TensorView::read);
+    // Expose host memory to NumPy without a copy, e.g. numpy.array(tensor_view, copy=False)
+    tensorView.def_buffer([](ngraph::runtime::TensorView& self) {
+        void* ptr = self.get_host_data_ptr();
+        if (ptr == nullptr)
+        {
+            throw py::buffer_error("TensorView data is not accessible in host memory");
+        }
+        const ngraph::element::Type& type = self.get_tensor().get_element_type();
+        const ngraph::Shape& shape = self.get_shape();
+        std::vector<ssize_t> sizes(shape.begin(), shape.end());
+        std::vector<ssize_t> strides(shape.size());
+        ssize_t stride = type.size();
+        for (size_t i = shape.size(); i-- > 0;)
+        {
+            strides[i] = stride;
+            stride *= shape[i];
+        }
+        return py::buffer_info(ptr,
+                               type.size(),
+                               get_buffer_format(type),
+                               static_cast<ssize_t>(shape.size()),
+                               sizes,
+                               strides);
+    });
 
     tensorView.def_property_readonly("shape", &ngraph::runtime::TensorView::get_shape);
     tensorView.def_property_readonly("element_count",
@@ -39,4 +118,7 @@ void regclass_pyngraph_runtime_TensorView(py::module m)
     tensorView.def_property_readonly("element_type", [](const ngraph::runtime::TensorView& self) {
         return self.get_tensor().get_element_type();
     });
+    tensorView.def_property_readonly("host_accessible", [](ngraph::runtime::TensorView& self) {
+        return self.get_host_data_ptr() != nullptr;
+    });
 }
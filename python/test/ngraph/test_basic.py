@@ -19,7 +19,7 @@ import json
 
 import ngraph as ng
 from test.ngraph.util import get_runtime, run_op_node
-from ngraph.impl import Function, NodeVector
+from ngraph.impl import Function, NodeVector, Type
 from ngraph.exceptions import UserInputError
 
 
@@ -70,6 +70,61 @@ def test_function_call():
     assert np.allclose(result, np.array([[54, 80], [110, 144]], dtype=dtype))
 
 
+def test_computation_multiple_outputs():
+    runtime = get_runtime()
+    dtype = np.float32
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=dtype, name='A')
+    parameter_b = ng.parameter(shape, dtype=dtype, name='B')
+    func = Function(NodeVector([parameter_a + parameter_b, parameter_a * parameter_b]),
+                    [parameter_a, parameter_b], 'add_and_mul')
+    computation = runtime.computation(func)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=dtype)
+    value_b = np.array([[5, 6], [7, 8]], dtype=dtype)
+    result_add, result_mul = computation(value_a, value_b)
+    assert np.allclose(result_add, np.array([[6, 8], [10, 12]], dtype=dtype))
+    assert np.allclose(result_mul, np.array([[5, 12], [21, 32]], dtype=dtype))
+
+    # Non-contiguous and mistyped inputs are copied
+    value_a = np.array([[1, 3], [2, 4]], dtype=np.float64).T
+    result_add, result_mul = computation(value_a, value_b)
+    assert np.allclose(result_add, np.array([[6, 8], [10, 12]], dtype=dtype))
+    assert np.allclose(result_mul, np.array([[5, 12], [21, 32]], dtype=dtype))
+
+
+@pytest.config.gpu_skip(reason='Not implemented')
+def test_computation_zero_copy():
+    runtime = get_runtime()
+    dtype = np.float32
+    shape = [2, 2]
+
+    # A tensor created from an array shares its memory
+    value = np.array([[1, 2], [3, 4]], dtype=dtype)
+    tensor_view = runtime.backend.create_tensor(Type.f32, shape, value)
+    if tensor_view.host_accessible:
+        assert np.shares_memory(np.asarray(tensor_view), value)
+        value[0, 0] = 10
+        assert np.asarray(tensor_view)[0, 0] == 10
+
+    parameter_a = ng.parameter(shape, dtype=dtype, name='A')
+    parameter_b = ng.parameter(shape, dtype=dtype, name='B')
+    computation = runtime.computation(parameter_a + parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=dtype)
+    value_b = np.array([[5, 6], [7, 8]], dtype=dtype)
+    result = computation(value_a, value_b)
+    assert np.allclose(result, np.array([[6, 8], [10, 12]], dtype=dtype))
+
+    # Changes to an input array show up in the next call, which overwrites the result
+    value_a[1, 1] = 40
+    next_result = computation(value_a, value_b)
+    assert np.allclose(next_result, np.array([[6, 8], [10, 48]], dtype=dtype))
+    if computation.result_views[0].host_accessible:
+        assert np.shares_memory(result, next_result)
+        assert np.allclose(result, next_result)
+
+
 def test_serialization():
     dtype = np.float32
     backend_name = pytest.config.getoption('backend', default='CPU')
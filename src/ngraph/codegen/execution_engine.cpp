@@ -14,14 +14,102 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdio>
+#include <fstream>
+#include <map>
+
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
 
+// Write through a process-unique temporary file so that a concurrent reader never sees a
+// partially written file
+static bool write_file(const std::string& path, const char* data, size_t size)
+{
+    std::string tmp_path = path + "." + std::to_string(llvm::sys::Process::getProcessId());
+    std::ofstream out(tmp_path, std::ios::binary);
+    out.write(data, size);
+    out.close();
+    if (!out || std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Returns the functions listed in llvm.global_ctors or llvm.global_dtors and gives them
+// external linkage so that they can be found by name in the generated object code
+static std::vector<std::string> export_static_functions(llvm::Module& module,
+                                                        const std::string& list_name)
+{
+    std::vector<std::string> names;
+    llvm::GlobalVariable* list = module.getNamedGlobal(list_name);
+    if (list && list->hasInitializer())
+    {
+        if (auto entries = llvm::dyn_cast<llvm::ConstantArray>(list->getInitializer()))
+        {
+            for (llvm::Value* value : entries->operand_values())
+            {
+                auto entry = llvm::dyn_cast<llvm::ConstantStruct>(value);
+                if (!entry)
+                {
+                    continue;
+                }
+                auto function =
+                    llvm::dyn_cast<llvm::Function>(entry->getOperand(1)->stripPointerCasts());
+                if (function)
+                {
+                    function->setLinkage(llvm::GlobalValue::ExternalLinkage);
+                    function->setVisibility(llvm::GlobalValue::DefaultVisibility);
+                    names.push_back(function->getName().str());
+                }
+            }
+        }
+    }
+    return names;
+}
+
+namespace
+{
+    // Saves the object code MCJIT generates for a module
+    class ObjectFileWriter : public llvm::ObjectCache
+    {
+    public:
+        ObjectFileWriter(const std::string& path)
+            : m_path(path)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef obj) override
+        {
+            write_file(m_path, obj.getBufferStart(), obj.getBufferSize());
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            return nullptr;
+        }
+
+    private:
+        std::string m_path;
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
+    , m_object_loaded{false}
 {
 }
 
@@ -29,7 +117,30 @@ codegen::ExecutionEngine::~ExecutionEngine()
 {
     if (m_execution_engine)
     {
-        m_execution_engine->runStaticConstructorsDestructors(true);
+        if (m_object_loaded)
+        {
+            run_static_functions(m_static_destructors);
+        }
+        else
+        {
+            m_execution_engine->runStaticConstructorsDestructors(true);
+        }
+    }
+}
+
+void codegen::ExecutionEngine::create_execution_engine(std::unique_ptr<llvm::Module> module)
+{
+    m_execution_engine.reset(llvm::EngineBuilder(move(module))
+                                 .setEngineKind(llvm::EngineKind::JIT)
+                                 .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                                 .setMCPU(llvm::sys::getHostCPUName())
+                                 //  .setCodeModel(llvm::CodeModel::Medium)
+                                 .setErrorStr(&m_jit_error)
+                                 .create());
+
+    if (m_execution_engine && m_object_cache)
+    {
+        m_execution_engine->setObjectCache(m_object_cache.get());
     }
 }
 
@@ -39,13 +150,22 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     {
         if (!m_execution_engine)
         {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
-                                         .setEngineKind(llvm::EngineKind::JIT)
-                                         .setOptLevel(llvm::CodeGenOpt::Aggressive)
-                                         .setMCPU(llvm::sys::getHostCPUName())
-                                         //  .setCodeModel(llvm::CodeModel::Medium)
-                                         .setErrorStr(&m_jit_error)
-                                         .create());
+            std::unique_ptr<llvm::Module> llvm_module = module->take_module();
+            if (m_object_cache)
+            {
+                std::string symbols;
+                for (auto& name : export_static_functions(*llvm_module, "llvm.global_ctors"))
+                {
+                    symbols += "ctor " + name + "\n";
+                }
+                for (auto& name : export_static_functions(*llvm_module, "llvm.global_dtors"))
+                {
+                    symbols += "dtor " + name + "\n";
+                }
+                write_file(m_object_path + ".symbols", symbols.data(), symbols.size());
+            }
+
+            create_execution_engine(move(llvm_module));
 
             if (!m_execution_engine)
             {
@@ -66,7 +186,14 @@ void codegen::ExecutionEngine::finalize()
     if (m_execution_engine)
     {
         m_execution_engine->finalizeObject();
-        m_execution_engine->runStaticConstructorsDestructors(false);
+        if (m_object_loaded)
+        {
+            run_static_functions(m_static_constructors);
+        }
+        else
+        {
+            m_execution_engine->runStaticConstructorsDestructors(false);
+        }
     }
     else
     {
@@ -76,6 +203,99 @@ void codegen::ExecutionEngine::finalize()
     }
 }
 
+std::string codegen::ExecutionEngine::get_object_key(const std::string& source)
+{
+    llvm::MD5 hash;
+    hash.update(NGRAPH_VERSION);
+    hash.update(llvm::sys::getHostCPUName());
+    llvm::StringMap<bool> host_features;
+    if (llvm::sys::getHostCPUFeatures(host_features))
+    {
+        // StringMap iteration order is unspecified
+        std::map<std::string, bool> features;
+        for (auto& feature : host_features)
+        {
+            features[feature.getKey().str()] = feature.getValue();
+        }
+        for (auto& feature : features)
+        {
+            hash.update((feature.second ? "+" : "-") + feature.first);
+        }
+    }
+    hash.update(source);
+
+    llvm::MD5::MD5Result result;
+    hash.final(result);
+    llvm::SmallString<32> digest;
+    llvm::MD5::stringifyResult(result, digest);
+    return digest.str().str();
+}
+
+void codegen::ExecutionEngine::save_object(const std::string& path)
+{
+    m_object_path = path;
+    m_object_cache.reset(new ObjectFileWriter(path));
+}
+
+bool codegen::ExecutionEngine::load_object(const std::string& path)
+{
+    if (m_execution_engine)
+    {
+        return false;
+    }
+
+    std::ifstream symbols(path + ".symbols");
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!symbols || !buffer)
+    {
+        return false;
+    }
+
+    auto object = llvm::object::ObjectFile::createObjectFile((*buffer)->getMemBufferRef());
+    if (!object)
+    {
+        llvm::consumeError(object.takeError());
+        return false;
+    }
+
+    std::vector<std::string> constructors;
+    std::vector<std::string> destructors;
+    std::string kind;
+    std::string name;
+    while (symbols >> kind >> name)
+    {
+        (kind == "ctor" ? constructors : destructors).push_back(name);
+    }
+
+    // MCJIT needs a module to create the engine, the object code is added next to it
+    m_context.reset(new llvm::LLVMContext());
+    create_execution_engine(
+        std::unique_ptr<llvm::Module>(new llvm::Module("ngraph_object", *m_context)));
+    if (!m_execution_engine)
+    {
+        return false;
+    }
+    m_execution_engine->addObjectFile(llvm::object::OwningBinary<llvm::object::ObjectFile>(
+        move(*object), move(*buffer)));
+
+    m_static_constructors = constructors;
+    m_static_destructors = destructors;
+    m_object_loaded = true;
+    return true;
+}
+
+void codegen::ExecutionEngine::run_static_functions(const std::vector<std::string>& names)
+{
+    for (auto& name : names)
+    {
+        auto function = find_function<void()>(name);
+        if (function)
+        {
+            function();
+        }
+    }
+}
+
 void* codegen::ExecutionEngine::get_pointer_to_named_function(const std::string& func_name)
 {
 // For whatever reason, macOS seems to expect that we prefix this with an underscore.
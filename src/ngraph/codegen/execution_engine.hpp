@@ -18,6 +18,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "ngraph/codegen/compiler.hpp"
 
@@ -33,6 +35,8 @@ namespace llvm
 {
     class Module;
     class ExecutionEngine;
+    class LLVMContext;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -44,6 +48,22 @@ public:
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
     void finalize();
 
+    /// \brief Returns a cache key for source compiled for this host by this build of nGraph
+    static std::string get_object_key(const std::string& source);
+
+    /// \brief Write the object code generated for the next module added to path.
+    ///
+    /// Must be called before add_module. The object is written during finalize and can be
+    /// loaded by a later process with load_object.
+    void save_object(const std::string& path);
+
+    /// \brief Load object code written by save_object instead of adding a module.
+    /// \returns false if path does not exist or does not contain usable object code
+    bool load_object(const std::string& path);
+
+    /// \brief True if the engine runs object code loaded by load_object
+    bool is_object_loaded() const { return m_object_loaded; }
+
     template <typename ftype>
     std::function<ftype> find_function(const std::string& func_name)
     {
@@ -51,8 +71,20 @@ public:
     }
 
 private:
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
+    std::string m_object_path;
+
+    // Static constructors and destructors of loaded object code. MCJIT only finds these
+    // in the IR of added modules so their names are saved alongside the object.
+    std::vector<std::string> m_static_constructors;
+    std::vector<std::string> m_static_destructors;
+    bool m_object_loaded;
+
+    void create_execution_engine(std::unique_ptr<llvm::Module> module);
+    void run_static_functions(const std::vector<std::string>& names);
 
     void* get_pointer_to_named_function(const std::string& func_name);
     template <typename signature>
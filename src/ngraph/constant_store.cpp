@@ -0,0 +1,250 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ngraph/constant_store.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+ConstantStore::Buffer::Buffer(const void* ptr, size_t size, uint64_t hash)
+    : m_ptr(ptr)
+    , m_size(size)
+    , m_hash(hash)
+    , m_mapping(nullptr)
+    , m_mapping_size(0)
+{
+}
+
+ConstantStore::Buffer::~Buffer()
+{
+    if (m_parent != nullptr)
+    {
+        // a slice points into its parent, which releases the data
+        return;
+    }
+    if (m_mapping != nullptr)
+    {
+        munmap(m_mapping, m_mapping_size);
+    }
+    else if (m_ptr != nullptr)
+    {
+        aligned_free(const_cast<void*>(m_ptr));
+    }
+}
+
+ConstantStore& ConstantStore::get_default()
+{
+    // Never destroyed, constants in static storage may outlive any other static
+    static ConstantStore* s_store = new ConstantStore();
+    return *s_store;
+}
+
+uint64_t ConstantStore::hash(const void* data, size_t size)
+{
+    // Multiply-rotate over 64-bit words. Not collision resistant, buffers with equal
+    // hashes are compared before they are shared.
+    const uint64_t k = 0x9E3779B97F4A7C15ULL;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint64_t h = size * k;
+    auto mix = [&](uint64_t word) {
+        h ^= word * k;
+        h = ((h << 31) | (h >> 33)) * k;
+    };
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, p + i, sizeof(word));
+        mix(word);
+    }
+    if (i < size)
+    {
+        uint64_t word = 0;
+        memcpy(&word, p + i, size - i);
+        mix(word);
+    }
+    h ^= h >> 29;
+    return h;
+}
+
+shared_ptr<const ConstantStore::Buffer> ConstantStore::intern(const void* data, size_t size)
+{
+    uint64_t h = hash(data, size);
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto range = m_buffers.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            auto existing = it->second.second.lock();
+            if (existing != nullptr && existing->size() == size &&
+                (size == 0 || memcmp(existing->get_ptr(), data, size) == 0))
+            {
+                return existing;
+            }
+        }
+    }
+    void* copy = aligned_alloc(s_alignment, round_up(max<size_t>(size, 1), s_alignment));
+    if (size > 0)
+    {
+        memcpy(copy, data, size);
+    }
+    return find_or_insert(new Buffer(copy, size, h));
+}
+
+shared_ptr<const ConstantStore::Buffer> ConstantStore::adopt(void* data, size_t size)
+{
+    return find_or_insert(new Buffer(data, size, hash(data, size)));
+}
+
+// Maps size bytes of a file starting at offset; returns the start of the mapping, which
+// is offset rounded down to a page, and sets data to the requested byte
+static void* map_range(const string& path,
+                       size_t offset,
+                       size_t size,
+                       size_t& mapping_size,
+                       const void*& data)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw ngraph_error("Failed to open constant data file '" + path + "'");
+    }
+    if (size == 0)
+    {
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+        {
+            close(fd);
+            throw ngraph_error("Failed to map empty constant data file '" + path + "'");
+        }
+        size = static_cast<size_t>(file_stat.st_size) - offset;
+    }
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t page_offset = offset - offset % page_size;
+    mapping_size = size + (offset - page_offset);
+    void* mapping = mmap(nullptr,
+                         mapping_size,
+                         PROT_READ,
+                         MAP_PRIVATE,
+                         fd,
+                         static_cast<off_t>(page_offset));
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw ngraph_error("Failed to map constant data file '" + path + "'");
+    }
+    data = static_cast<const char*>(mapping) + (offset - page_offset);
+    return mapping;
+}
+
+shared_ptr<const ConstantStore::Buffer>
+    ConstantStore::map_file(const string& path, size_t offset, size_t size)
+{
+    if (size == 0)
+    {
+        return intern(nullptr, 0);
+    }
+    size_t mapping_size;
+    const void* data;
+    void* mapping = map_range(path, offset, size, mapping_size, data);
+    Buffer* buffer = new Buffer(data, size, 0);
+    buffer->m_mapping = mapping;
+    buffer->m_mapping_size = mapping_size;
+    return shared_ptr<const Buffer>(buffer);
+}
+
+shared_ptr<const ConstantStore::Buffer> ConstantStore::map_file(const string& path)
+{
+    size_t mapping_size;
+    const void* data;
+    void* mapping = map_range(path, 0, 0, mapping_size, data);
+    Buffer* buffer = new Buffer(data, mapping_size, 0);
+    buffer->m_mapping = mapping;
+    buffer->m_mapping_size = mapping_size;
+    return shared_ptr<const Buffer>(buffer);
+}
+
+shared_ptr<const ConstantStore::Buffer> ConstantStore::slice(
+    const shared_ptr<const Buffer>& parent, size_t offset, size_t size)
+{
+    if (offset + size > parent->size())
+    {
+        throw ngraph_error("Constant data slice exceeds its buffer");
+    }
+    Buffer* buffer = new Buffer(static_cast<const char*>(parent->get_ptr()) + offset, size, 0);
+    buffer->m_parent = parent;
+    return shared_ptr<const Buffer>(buffer);
+}
+
+shared_ptr<const ConstantStore::Buffer> ConstantStore::find_or_insert(Buffer* buffer)
+{
+    unique_lock<mutex> lock(m_mutex);
+    auto range = m_buffers.equal_range(buffer->get_hash());
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto existing = it->second.second.lock();
+        if (existing != nullptr && existing->size() == buffer->size() &&
+            (buffer->size() == 0 ||
+             memcmp(existing->get_ptr(), buffer->get_ptr(), buffer->size()) == 0))
+        {
+            lock.unlock();
+            delete buffer;
+            return existing;
+        }
+    }
+    shared_ptr<const Buffer> result(buffer, [this](const Buffer* b) { release(b); });
+    m_buffers.emplace(buffer->get_hash(), make_pair(buffer, weak_ptr<const Buffer>(result)));
+    m_byte_count += buffer->size();
+    return result;
+}
+
+void ConstantStore::release(const Buffer* buffer)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto range = m_buffers.equal_range(buffer->get_hash());
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.first == buffer)
+            {
+                m_buffers.erase(it);
+                m_byte_count -= buffer->size();
+                break;
+            }
+        }
+    }
+    delete buffer;
+}
+
+size_t ConstantStore::get_buffer_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_buffers.size();
+}
+
+size_t ConstantStore::get_byte_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_byte_count;
+}
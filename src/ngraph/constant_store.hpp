@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Process-wide store of immutable constant data shared by op::Constant nodes.
+    ///
+    /// Buffers are keyed by a hash of their content, so constants with identical data share
+    /// one copy across Functions and call frames no matter how they were created. A buffer
+    /// is released when the last constant referring to it is destroyed. Buffers can also be
+    /// backed by read-only mappings of files. Those are never hashed, so weights are paged in
+    /// on demand and shared with other processes mapping the same file, but not by content.
+    class ConstantStore
+    {
+    public:
+        class Buffer
+        {
+        public:
+            ~Buffer();
+
+            const void* get_ptr() const { return m_ptr; }
+            size_t size() const { return m_size; }
+            uint64_t get_hash() const { return m_hash; }
+            bool is_mapped() const
+            {
+                return m_mapping != nullptr || (m_parent != nullptr && m_parent->is_mapped());
+            }
+
+        private:
+            friend class ConstantStore;
+            Buffer(const void* ptr, size_t size, uint64_t hash);
+            Buffer(const Buffer&) = delete;
+            Buffer& operator=(const Buffer&) = delete;
+
+            const void* m_ptr;
+            size_t m_size;
+            uint64_t m_hash;
+            // Start and length of the file mapping, nullptr for heap buffers
+            void* m_mapping;
+            size_t m_mapping_size;
+            // The buffer a slice points into
+            std::shared_ptr<const Buffer> m_parent;
+        };
+
+        /// \brief The store shared by all constants
+        static ConstantStore& get_default();
+
+        /// \brief Returns the buffer holding data, copying data only if no buffer with the
+        ///     same content exists.
+        std::shared_ptr<const Buffer> intern(const void* data, size_t size);
+
+        /// \brief Like intern(), but takes ownership of data, which must have been allocated
+        ///     by ngraph::aligned_alloc. data is freed if an equal buffer exists.
+        std::shared_ptr<const Buffer> adopt(void* data, size_t size);
+
+        /// \brief Returns a buffer backed by a read-only mapping of size bytes of a file,
+        ///     starting at offset. It is neither hashed nor shared by content, so no page is
+        ///     touched until it is read.
+        std::shared_ptr<const Buffer>
+            map_file(const std::string& path, size_t offset, size_t size);
+
+        /// \brief Returns a read-only mapping of a whole file, like map_file(path, 0, size of
+        ///     the file).
+        std::shared_ptr<const Buffer> map_file(const std::string& path);
+
+        /// \brief Returns size bytes of parent starting at offset, keeping parent alive. Like
+        ///     mapped buffers, slices are not hashed or shared by content.
+        std::shared_ptr<const Buffer>
+            slice(const std::shared_ptr<const Buffer>& parent, size_t offset, size_t size);
+
+        /// \brief Number of distinct buffers alive
+        size_t get_buffer_count() const;
+        /// \brief Total size of the distinct buffers alive
+        size_t get_byte_count() const;
+
+        static uint64_t hash(const void* data, size_t size);
+
+        /// \brief Alignment of the buffers the store allocates
+        static constexpr size_t s_alignment = 64;
+
+    private:
+        ConstantStore() = default;
+        std::shared_ptr<const Buffer> find_or_insert(Buffer* buffer);
+        void release(const Buffer* buffer);
+
+        mutable std::mutex m_mutex;
+        std::unordered_multimap<uint64_t,
+                                std::pair<const Buffer*, std::weak_ptr<const Buffer>>>
+            m_buffers;
+        size_t m_byte_count = 0;
+    };
+}
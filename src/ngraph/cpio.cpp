@@ -126,11 +126,23 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     write_u32(stream, 0);        // mtime
     write_u16(stream, namesize); // namesize
     write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    stream.write(name.c_str(), namesize);
+    if (namesize % 2)
+    {
+        stream.put(0);
+    }
+}
+
+// Size of the header and name of a file record
+static size_t header_size(const string& name)
+{
+    size_t namesize = name.size() + 1;
+    return 26 + namesize + (namesize % 2);
 }
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_offset(0)
 {
 }
 
@@ -154,12 +166,14 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_offset = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
+    m_offset = 0;
 }
 
 void cpio::Writer::close()
@@ -182,6 +196,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_offset += header_size(record_name) + size_in_bytes + (size_in_bytes % 2);
     }
     else
     {
@@ -189,6 +204,23 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     }
 }
 
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
+{
+    // Every record has an even size, so an even amount of padding data lines the file up
+    static const string padding_name = "PADDING!!!";
+    size_t data_offset = m_offset + header_size(record_name);
+    if (data_offset % alignment != 0)
+    {
+        size_t padded_offset = data_offset + header_size(padding_name);
+        vector<char> padding((alignment - padded_offset % alignment) % alignment, 0);
+        write(padding_name, padding.data(), static_cast<uint32_t>(padding.size()));
+    }
+    write(record_name, data, size_in_bytes);
+}
+
 cpio::Reader::Reader()
     : m_stream(nullptr)
 {
@@ -255,6 +287,7 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
             }
 
             size_t offset = m_stream->tellg();
+            m_file_index.emplace(file_name, m_file_info.size());
             m_file_info.emplace_back(file_name, header.filesize, offset);
 
             m_stream->seekg((header.filesize % 2) + header.filesize, ios_base::cur);
@@ -264,20 +297,23 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
     return m_file_info;
 }
 
+const cpio::FileInfo* cpio::Reader::find(const string& file_name)
+{
+    get_file_info();
+    auto it = m_file_index.find(file_name);
+    return it == m_file_index.end() ? nullptr : &m_file_info[it->second];
+}
+
 void cpio::Reader::read(const string& file_name, void* data, size_t size_in_bytes)
 {
-    for (const FileInfo& info : get_file_info())
+    if (const FileInfo* info = find(file_name))
     {
-        if (info.get_name() == file_name)
+        if (size_in_bytes != info->get_size())
         {
-            if (size_in_bytes != info.get_size())
-            {
-                throw runtime_error("Buffer size does not match file size");
-            }
-            m_stream->seekg(info.get_offset(), ios_base::beg);
-            m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
-            break;
+            throw runtime_error("Buffer size does not match file size");
         }
+        m_stream->seekg(info->get_offset(), ios_base::beg);
+        m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
     }
 }
 
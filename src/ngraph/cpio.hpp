@@ -19,6 +19,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ngraph
@@ -87,10 +88,18 @@ public:
     void open(const std::string& filename);
     void close();
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+    /// \brief Writes a file whose data starts at a multiple of alignment bytes from the start
+    ///    of the archive, preceded by a padding file when needed. alignment must be even.
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment);
 
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    // Bytes written since the archive was opened
+    size_t m_offset;
 };
 
 class ngraph::cpio::Reader
@@ -105,10 +114,14 @@ public:
     void open(const std::string& filename);
     void close();
     const std::vector<FileInfo>& get_file_info();
+    /// \return the first file called file_name, or nullptr if there is none
+    const FileInfo* find(const std::string& file_name);
     void read(const std::string& file_name, void* data, size_t size_in_bytes);
 
 private:
     std::istream* m_stream;
     std::ifstream m_my_stream;
     std::vector<cpio::FileInfo> m_file_info;
+    // Position of each file in m_file_info, by name
+    std::unordered_map<std::string, size_t> m_file_index;
 };
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/node.hpp"
@@ -22,6 +24,8 @@
 using namespace ngraph;
 using namespace descriptor;
 
+static std::atomic<size_t> s_replacement_count{0};
+
 Input::Input(Node* node, size_t index, Output& output)
     : m_node(node)
     , m_index(index)
@@ -37,6 +41,7 @@ void Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    s_replacement_count++;
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
@@ -54,6 +59,11 @@ void Input::replace_output(std::shared_ptr<Node> node, size_t i)
     replace_output(node->m_outputs.at(i));
 }
 
+size_t Input::get_replacement_count()
+{
+    return s_replacement_count;
+}
+
 std::shared_ptr<Node> Input::get_node() const
 {
     return m_node->shared_from_this();
@@ -31,7 +31,7 @@ namespace ngraph
         // Describes a tensor that is an input to an op, directly or indirectly via a tuple
         class Input
         {
-            friend class Node;
+            friend class ngraph::Node;
 
         public:
             /// \param node The node that owns this input
@@ -57,6 +57,10 @@ namespace ngraph
             void replace_output(std::shared_ptr<Node> node, size_t i);
             void replace_output(Output& output);
 
+            /// \return the number of times any input has been connected to another output,
+            ///     which changes whenever a graph is rewritten
+            static size_t get_replacement_count();
+
         protected:
             /// \return the tensor view for the connected output
             std::shared_ptr<const TensorView> get_tensor_view() const;
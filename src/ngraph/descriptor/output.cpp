@@ -28,10 +28,12 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 {
 }
 
-// Add an input to the vector of inputs that use this output.
+// Add an input to the vector of inputs that use this output. An input is only added when it is
+// connected to this output, after being removed from the output it used before, so it is
+// never already present.
 void descriptor::Output::add_input(Input* input)
 {
-    m_inputs.insert(input);
+    m_inputs.push_back(input);
 }
 
 void descriptor::Output::remove_input(Input* input)
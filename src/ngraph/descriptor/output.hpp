@@ -17,14 +17,14 @@
 #pragma once
 
 #include <memory>
-#include <set>
 
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/small_vector.hpp"
 
 namespace ngraph
 {
-    // The forward declaration of Node is needed here because Node has a deque of
+    // The forward declaration of Node is needed here because Node stores its
     // Outputs, and Output is an incomplete type at this point. STL containers of
     // incomplete type have undefined behavior according to the C++11 standard, and
     // in practice including node.hpp here was causing compilation errors on some
@@ -37,6 +37,9 @@ namespace ngraph
         class Output
         {
         public:
+            /// The inputs reading an output, in the order they were connected
+            using Inputs = SmallVector<Input*, 2>;
+
             /// \param node Node that owns this output.
             /// \param index Position of the output tensor in all output tensors
             /// \param tensor The view of this tensor; where the value will be written
@@ -48,7 +51,7 @@ namespace ngraph
             void set_tensor_view(const std::shared_ptr<Tensor>& tensor) { m_tensor = tensor; }
             void add_input(Input* input);
             void remove_input(Input* input);
-            const std::set<Input*>& get_inputs() const { return m_inputs; }
+            const Inputs& get_inputs() const { return m_inputs; }
             Tensor& get_tensor() const;
 
             /// \return the shape of the output
@@ -60,7 +63,7 @@ namespace ngraph
             Node* m_node;
             size_t m_index;
             std::shared_ptr<Tensor> m_tensor;
-            std::set<Input*> m_inputs;
+            Inputs m_inputs;
 
         private:
             Output(const Output&) = delete;
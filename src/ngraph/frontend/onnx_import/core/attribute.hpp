@@ -188,6 +188,16 @@ namespace ngraph
                     return attribute.s();
                 }
 
+                template <>
+                inline std::string get_value(const onnx::AttributeProto& attribute)
+                {
+                    if (unlikely(attribute.type() != onnx::AttributeProto_AttributeType_STRING))
+                    {
+                        throw error::attribute::InvalidData{attribute.type()};
+                    }
+                    return attribute.s();
+                }
+
                 template <>
                 inline std::vector<std::string> get_value(const onnx::AttributeProto& attribute)
                 {
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "graph.hpp"
 #include "node.hpp"
 
@@ -51,7 +53,10 @@ namespace ngraph
                 m_nodes.emplace_back(node_proto, this);
                 const Node& node{m_nodes.back()};
                 NodeVector ng_nodes{node.get_ng_nodes()};
-                for (int i = 0; i < ng_nodes.size(); i++)
+                // Trailing optional outputs may be left out of the ONNX node
+                std::size_t outputs_count{
+                    std::min(ng_nodes.size(), node.get_output_names().size())};
+                for (std::size_t i = 0; i < outputs_count; i++)
                 {
                     m_ng_node_cache[node.output(i)] = ng_nodes[i];
                 }
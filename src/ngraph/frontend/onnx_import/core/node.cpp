@@ -33,6 +33,11 @@ namespace ngraph
             return result;
         }
 
+        std::shared_ptr<ngraph::Node> Node::get_ng_input(std::size_t index) const
+        {
+            return m_graph->get_ng_node_from_cache(m_input_names.at(index));
+        }
+
         std::string Node::get_description() const
         {
             if (!get_name().empty())
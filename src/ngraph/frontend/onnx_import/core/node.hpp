@@ -56,6 +56,7 @@ namespace ngraph
                 : m_node_proto{&node_proto}
                 , m_graph{graph}
                 , m_attributes{std::begin(node_proto.attribute()), std::end(node_proto.attribute())}
+                , m_input_names{std::begin(node_proto.input()), std::end(node_proto.input())}
                 , m_output_names{std::begin(node_proto.output()), std::end(node_proto.output())}
             {
             }
@@ -69,6 +70,7 @@ namespace ngraph
             const std::vector<Attribute>& attributes() const { return m_attributes; }
             NodeVector get_ng_nodes() const;
             NodeVector get_ng_inputs() const;
+            std::shared_ptr<ngraph::Node> get_ng_input(std::size_t index) const;
 
             const std::string& op_type() const { return m_node_proto->op_type(); }
             const std::string& get_name() const { return m_node_proto->name(); }
@@ -77,6 +79,11 @@ namespace ngraph
             /// \return Description of Node
             std::string get_description() const;
 
+            /// \return Names of the inputs, an omitted optional input has an empty name
+            const std::vector<std::reference_wrapper<const std::string>>& get_input_names() const
+            {
+                return m_input_names;
+            }
             const std::vector<std::reference_wrapper<const std::string>>& get_output_names() const
             {
                 return m_output_names;
@@ -114,6 +121,7 @@ namespace ngraph
             const onnx::NodeProto* m_node_proto;
             const Graph* m_graph;
             std::vector<Attribute> m_attributes;
+            std::vector<std::reference_wrapper<const std::string>> m_input_names;
             std::vector<std::reference_wrapper<const std::string>> m_output_names;
         };
 
@@ -263,6 +263,18 @@ namespace ngraph
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
+            /// \brief Returns the serialized values if they already have the layout of a
+            ///        constant of element type type and the tensor's shape, nullptr otherwise.
+            const void* get_raw_data(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment() || !m_tensor_proto->has_raw_data() ||
+                    m_tensor_proto->raw_data().size() != shape_size(m_shape) * type.size())
+                {
+                    return nullptr;
+                }
+                return m_tensor_proto->raw_data().data();
+            }
+
             const std::string& get_name() const
             {
                 if (!m_tensor_proto->has_name())
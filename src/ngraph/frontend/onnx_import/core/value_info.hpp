@@ -121,7 +121,9 @@ namespace ngraph
         protected:
             std::shared_ptr<op::Parameter> get_ng_parameter() const
             {
-                return std::make_shared<op::Parameter>(get_element_type(), get_shape());
+                auto parameter = std::make_shared<op::Parameter>(get_element_type(), get_shape());
+                parameter->set_name(get_name());
+                return parameter;
             }
 
             std::shared_ptr<op::Constant> get_ng_constant(const Tensor& tensor) const
@@ -161,6 +163,12 @@ namespace ngraph
             std::shared_ptr<op::Constant> make_ng_constant(const element::Type& type,
                                                            const Tensor& tensor) const
             {
+                // Raw data is copied straight into the constant store, or not at all if the
+                // same weights were loaded before
+                if (const void* raw_data = tensor.get_raw_data(type))
+                {
+                    return std::make_shared<op::Constant>(type, m_shape, raw_data);
+                }
                 return std::make_shared<op::Constant>(type, m_shape, tensor.get_data<T>());
             }
 
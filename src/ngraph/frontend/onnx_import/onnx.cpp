@@ -64,6 +64,7 @@ namespace ngraph
             {
                 output_functions.emplace_back(std::make_shared<Function>(
                     graph.get_ng_node_from_cache(output.get_name()), graph.get_ng_parameters()));
+                output_functions.back()->get_results().front()->set_name(output.get_name());
             }
             return output_functions;
         }
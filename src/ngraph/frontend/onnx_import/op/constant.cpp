@@ -31,6 +31,11 @@ namespace ngraph
                 inline std::shared_ptr<ngraph::op::Constant>
                     __make_ng_constant(const element::Type& type, const Tensor& tensor)
                 {
+                    if (const void* raw_data = tensor.get_raw_data(type))
+                    {
+                        return std::make_shared<ngraph::op::Constant>(
+                            type, tensor.get_shape(), raw_data);
+                    }
                     return std::make_shared<ngraph::op::Constant>(
                         type, tensor.get_shape(), tensor.get_data<T>());
                 }
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+
+#include "op/gru.hpp"
+#include "utils/recurrent.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace op
+        {
+            namespace
+            {
+                // ONNX packs GRU gates as [update, reset, hidden]
+                enum Gate
+                {
+                    update_gate = 0,
+                    reset_gate = 1,
+                    hidden_gate = 2
+                };
+
+            } // namespace anonymous
+
+            NodeVector gru(const Node& node)
+            {
+                auto layer = recurrent::get_layer(node, 3, {"Sigmoid", "Tanh"});
+                bool linear_before_reset{
+                    node.get_attribute_value<int64_t>("linear_before_reset", 0) != 0};
+
+                std::size_t hidden_size{layer.hidden_size};
+                Shape state_shape{layer.batch_size, hidden_size};
+                const element::Type& type{node.get_ng_input(0)->get_element_type()};
+                auto ones = recurrent::make_constant(type, state_shape, 1);
+
+                std::vector<NodeVector> sequence;
+                NodeVector final_h;
+                for (const auto& direction : layer.directions)
+                {
+                    NodeVector R;
+                    NodeVector Rb;
+                    for (auto gate : {update_gate, reset_gate, hidden_gate})
+                    {
+                        R.push_back(recurrent::get_gate(direction.R, gate, hidden_size, 0));
+                        Rb.push_back(recurrent::get_gate(direction.Rb, gate, hidden_size, 0));
+                    }
+                    const std::string& f{direction.activations.at(0)};
+                    const std::string& g{direction.activations.at(1)};
+
+                    auto ht = direction.initial_h;
+                    NodeVector outputs(layer.X.size());
+                    for (std::size_t i = 0; i < layer.X.size(); ++i)
+                    {
+                        std::size_t step{direction.reverse ? layer.X.size() - 1 - i : i};
+                        auto x_gates = recurrent::linear(layer.X[step], direction.W, direction.Wb);
+
+                        std::shared_ptr<ngraph::Node> zt = std::make_shared<ngraph::op::Add>(
+                            recurrent::get_gate(x_gates, update_gate, hidden_size, 1),
+                            recurrent::linear(ht, R[update_gate], Rb[update_gate]));
+                        zt = recurrent::activation(node, f, recurrent::clip(zt, layer.clip));
+                        std::shared_ptr<ngraph::Node> rt = std::make_shared<ngraph::op::Add>(
+                            recurrent::get_gate(x_gates, reset_gate, hidden_size, 1),
+                            recurrent::linear(ht, R[reset_gate], Rb[reset_gate]));
+                        rt = recurrent::activation(node, f, recurrent::clip(rt, layer.clip));
+
+                        std::shared_ptr<ngraph::Node> h_t;
+                        if (linear_before_reset)
+                        {
+                            h_t = std::make_shared<ngraph::op::Multiply>(
+                                rt, recurrent::linear(ht, R[hidden_gate], Rb[hidden_gate]));
+                        }
+                        else
+                        {
+                            h_t = recurrent::linear(std::make_shared<ngraph::op::Multiply>(rt, ht),
+                                                    R[hidden_gate],
+                                                    Rb[hidden_gate]);
+                        }
+                        h_t = std::make_shared<ngraph::op::Add>(
+                            recurrent::get_gate(x_gates, hidden_gate, hidden_size, 1), h_t);
+                        h_t = recurrent::activation(node, g, recurrent::clip(h_t, layer.clip));
+
+                        // Ht = (1 - zt) (.) ht + zt (.) Ht-1
+                        ht = std::make_shared<ngraph::op::Add>(
+                            std::make_shared<ngraph::op::Multiply>(
+                                std::make_shared<ngraph::op::Subtract>(ones, zt), h_t),
+                            std::make_shared<ngraph::op::Multiply>(zt, ht));
+                        outputs[step] = ht;
+                    }
+                    sequence.push_back(outputs);
+                    final_h.push_back(ht);
+                }
+
+                return {recurrent::stack_sequence(sequence), recurrent::stack_states(final_h)};
+            }
+
+        } // namespace op
+
+    } // namespace onnx_import
+
+} // namespace ngraph
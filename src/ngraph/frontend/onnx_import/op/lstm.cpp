@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+
+#include "exceptions.hpp"
+#include "op/lstm.hpp"
+#include "utils/recurrent.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace op
+        {
+            namespace
+            {
+                // Gate blocks of the cells built below. ONNX packs LSTM gates as
+                // [input, output, forget, cell]; the cells use [forget, input, cell, output],
+                // the layout the CPU backend LSTM and RNN fusions rewrite into its fused kernel.
+                enum Gate
+                {
+                    forget_gate = 0,
+                    input_gate = 1,
+                    cell_gate = 2,
+                    output_gate = 3
+                };
+
+                const std::vector<std::size_t> onnx_gate_order{2, 0, 3, 1};
+
+                std::shared_ptr<ngraph::Node>
+                    broadcast_peephole(const std::shared_ptr<ngraph::Node>& peepholes,
+                                       std::size_t gate,
+                                       const Shape& shape)
+                {
+                    return std::make_shared<ngraph::op::Broadcast>(
+                        recurrent::get_gate(peepholes, gate, shape.at(1), 0), shape, AxisSet{0});
+                }
+
+            } // namespace anonymous
+
+            NodeVector lstm(const Node& node)
+            {
+                auto layer = recurrent::get_layer(node, 4, {"Sigmoid", "Tanh", "Tanh"});
+                auto initial_c = recurrent::get_optional_input(node, 6);
+                auto peepholes = recurrent::get_optional_input(node, 7);
+                bool input_forget{node.get_attribute_value<int64_t>("input_forget", 0) != 0};
+
+                std::size_t hidden_size{layer.hidden_size};
+                Shape state_shape{layer.batch_size, hidden_size};
+                std::size_t num_directions{layer.directions.size()};
+                ASSERT_VALID_ARGUMENT(node,
+                                      initial_c == nullptr ||
+                                          initial_c->get_shape() ==
+                                              (Shape{num_directions,
+                                                     layer.batch_size,
+                                                     hidden_size}))
+                    << "input initial_c has invalid shape";
+                ASSERT_VALID_ARGUMENT(node,
+                                      peepholes == nullptr ||
+                                          peepholes->get_shape() ==
+                                              (Shape{num_directions, 3 * hidden_size}))
+                    << "input P has invalid shape";
+
+                const element::Type& type{node.get_ng_input(0)->get_element_type()};
+                std::vector<NodeVector> sequence;
+                NodeVector final_h;
+                NodeVector final_c;
+                for (const auto& direction : layer.directions)
+                {
+                    auto W = recurrent::reorder_gates(direction.W, onnx_gate_order, hidden_size);
+                    auto R = recurrent::reorder_gates(direction.R, onnx_gate_order, hidden_size);
+                    auto Wb = recurrent::reorder_gates(direction.Wb, onnx_gate_order, hidden_size);
+                    auto Rb = recurrent::reorder_gates(direction.Rb, onnx_gate_order, hidden_size);
+                    const std::string& f{direction.activations.at(0)};
+                    const std::string& g{direction.activations.at(1)};
+                    const std::string& h{direction.activations.at(2)};
+
+                    std::shared_ptr<ngraph::Node> p_i, p_o, p_f;
+                    if (peepholes != nullptr)
+                    {
+                        // Peepholes are packed as [input, output, forget]
+                        auto p = recurrent::get_direction(peepholes, direction.index);
+                        p_i = broadcast_peephole(p, 0, state_shape);
+                        p_o = broadcast_peephole(p, 1, state_shape);
+                        p_f = broadcast_peephole(p, 2, state_shape);
+                    }
+
+                    auto ht = direction.initial_h;
+                    auto ct = (initial_c != nullptr)
+                                  ? recurrent::get_direction(initial_c, direction.index)
+                                  : recurrent::make_constant(type, state_shape, 0);
+                    NodeVector outputs(layer.X.size());
+                    for (std::size_t i = 0; i < layer.X.size(); ++i)
+                    {
+                        std::size_t step{direction.reverse ? layer.X.size() - 1 - i : i};
+                        auto gates = std::make_shared<ngraph::op::Add>(
+                            recurrent::linear(ht, R, Rb), recurrent::linear(layer.X[step], W, Wb));
+
+                        auto it = recurrent::get_gate(gates, input_gate, hidden_size, 1);
+                        auto ft = recurrent::get_gate(gates, forget_gate, hidden_size, 1);
+                        auto c_t = recurrent::get_gate(gates, cell_gate, hidden_size, 1);
+                        auto ot = recurrent::get_gate(gates, output_gate, hidden_size, 1);
+                        if (peepholes != nullptr)
+                        {
+                            it = std::make_shared<ngraph::op::Add>(
+                                it, std::make_shared<ngraph::op::Multiply>(p_i, ct));
+                            ft = std::make_shared<ngraph::op::Add>(
+                                ft, std::make_shared<ngraph::op::Multiply>(p_f, ct));
+                        }
+
+                        it = recurrent::activation(node, f, recurrent::clip(it, layer.clip));
+                        if (input_forget)
+                        {
+                            ft = std::make_shared<ngraph::op::Subtract>(
+                                recurrent::make_constant(type, state_shape, 1), it);
+                        }
+                        else
+                        {
+                            ft = recurrent::activation(node, f, recurrent::clip(ft, layer.clip));
+                        }
+                        c_t = recurrent::activation(node, g, recurrent::clip(c_t, layer.clip));
+                        ct = std::make_shared<ngraph::op::Add>(
+                            std::make_shared<ngraph::op::Multiply>(ft, ct),
+                            std::make_shared<ngraph::op::Multiply>(it, c_t));
+
+                        if (peepholes != nullptr)
+                        {
+                            ot = std::make_shared<ngraph::op::Add>(
+                                ot, std::make_shared<ngraph::op::Multiply>(p_o, ct));
+                        }
+                        ot = recurrent::activation(node, f, recurrent::clip(ot, layer.clip));
+                        auto cell = std::make_shared<ngraph::op::Multiply>(
+                            ot, recurrent::activation(node, h, ct));
+                        // Lets the CPU backend replace the cell with its fused kernel
+                        cell->set_fusable_rnn_cell(true);
+                        ht = cell;
+                        outputs[step] = ht;
+                    }
+                    sequence.push_back(outputs);
+                    final_h.push_back(ht);
+                    final_c.push_back(ct);
+                }
+
+                return {recurrent::stack_sequence(sequence),
+                        recurrent::stack_states(final_h),
+                        recurrent::stack_states(final_c)};
+            }
+
+        } // namespace op
+
+    } // namespace onnx_import
+
+} // namespace ngraph
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/add.hpp"
+
+#include "op/rnn.hpp"
+#include "utils/recurrent.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace op
+        {
+            NodeVector rnn(const Node& node)
+            {
+                auto layer = recurrent::get_layer(node, 1, {"Tanh"});
+
+                std::vector<NodeVector> sequence;
+                NodeVector final_h;
+                for (const auto& direction : layer.directions)
+                {
+                    const std::string& f{direction.activations.at(0)};
+
+                    auto ht = direction.initial_h;
+                    NodeVector outputs(layer.X.size());
+                    for (std::size_t i = 0; i < layer.X.size(); ++i)
+                    {
+                        std::size_t step{direction.reverse ? layer.X.size() - 1 - i : i};
+                        std::shared_ptr<ngraph::Node> gates = std::make_shared<ngraph::op::Add>(
+                            recurrent::linear(ht, direction.R, direction.Rb),
+                            recurrent::linear(layer.X[step], direction.W, direction.Wb));
+                        ht = recurrent::activation(node, f, recurrent::clip(gates, layer.clip));
+                        outputs[step] = ht;
+                    }
+                    sequence.push_back(outputs);
+                    final_h.push_back(ht);
+                }
+
+                return {recurrent::stack_sequence(sequence), recurrent::stack_states(final_h)};
+            }
+
+        } // namespace op
+
+    } // namespace onnx_import
+
+} // namespace ngraph
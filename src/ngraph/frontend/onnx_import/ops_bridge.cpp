@@ -30,7 +30,9 @@
 #include "op/flatten.hpp"
 #include "op/gemm.hpp"
 #include "op/greater.hpp"
+#include "op/gru.hpp"
 #include "op/less.hpp"
+#include "op/lstm.hpp"
 #include "op/matmul.hpp"
 #include "op/max.hpp"
 #include "op/max_pool.hpp"
@@ -43,6 +45,7 @@
 #include "op/reduce.hpp"
 #include "op/relu.hpp"
 #include "op/reshape.hpp"
+#include "op/rnn.hpp"
 #include "op/shape.hpp"
 #include "op/softmax.hpp"
 #include "op/split.hpp"
@@ -108,7 +111,9 @@ namespace ngraph
                     m_map.emplace("Flatten", std::bind(op::flatten, std::placeholders::_1));
                     m_map.emplace("Gemm", std::bind(op::gemm, std::placeholders::_1));
                     m_map.emplace("Greater", std::bind(op::greater, std::placeholders::_1));
+                    m_map.emplace("GRU", std::bind(op::gru, std::placeholders::_1));
                     m_map.emplace("Less", std::bind(op::less, std::placeholders::_1));
+                    m_map.emplace("LSTM", std::bind(op::lstm, std::placeholders::_1));
                     m_map.emplace("MatMul", std::bind(op::matmul, std::placeholders::_1));
                     m_map.emplace("MaxPool", std::bind(op::max_pool, std::placeholders::_1));
                     m_map.emplace("Max", std::bind(op::max, std::placeholders::_1));
@@ -133,6 +138,7 @@ namespace ngraph
                                   std::bind(op::reduce_sum_square, std::placeholders::_1));
                     m_map.emplace("Relu", std::bind(op::relu, std::placeholders::_1));
                     m_map.emplace("Reshape", std::bind(op::reshape, std::placeholders::_1));
+                    m_map.emplace("RNN", std::bind(op::rnn, std::placeholders::_1));
                     m_map.emplace("Shape", std::bind(op::shape, std::placeholders::_1));
                     m_map.emplace("Softmax", std::bind(op::softmax, std::placeholders::_1));
                     m_map.emplace("Split", std::bind(op::split, std::placeholders::_1));
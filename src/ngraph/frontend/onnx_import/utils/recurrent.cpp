@@ -0,0 +1,315 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <iterator>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/tanh.hpp"
+
+#include "exceptions.hpp"
+#include "utils/recurrent.hpp"
+#include "utils/reshape.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace recurrent
+        {
+            namespace
+            {
+                std::shared_ptr<ngraph::Node> concat(const NodeVector& nodes, std::size_t axis)
+                {
+                    if (nodes.size() == 1)
+                    {
+                        return nodes.front();
+                    }
+                    return std::make_shared<ngraph::op::Concat>(nodes, axis);
+                }
+
+                std::shared_ptr<ngraph::Node> reshape(const std::shared_ptr<ngraph::Node>& node,
+                                                      const Shape& shape)
+                {
+                    return std::make_shared<ngraph::op::Reshape>(
+                        node, reshape::get_default_axis_vector(node->get_shape().size()), shape);
+                }
+
+            } // namespace anonymous
+
+            Layer get_layer(const Node& node,
+                            std::size_t gates_count,
+                            const std::vector<std::string>& default_activations)
+            {
+                auto X = node.get_ng_input(0);
+                auto W = node.get_ng_input(1);
+                auto R = node.get_ng_input(2);
+                auto B = get_optional_input(node, 3);
+                auto initial_h = get_optional_input(node, 5);
+
+                ASSERT_IS_SUPPORTED(node, get_optional_input(node, 4) == nullptr)
+                    << "the 'sequence_lens' input is not supported";
+                ASSERT_VALID_ARGUMENT(node, X->get_shape().size() == 3)
+                    << "input X must have shape [seq_length, batch_size, input_size]";
+
+                const Shape& x_shape = X->get_shape();
+                std::size_t seq_length{x_shape.at(0)};
+                std::size_t batch_size{x_shape.at(1)};
+                std::size_t input_size{x_shape.at(2)};
+                std::size_t hidden_size{node.get_attribute_value<std::size_t>("hidden_size")};
+                std::size_t gates_size{gates_count * hidden_size};
+
+                auto direction = node.get_attribute_value<std::string>("direction", "forward");
+                ASSERT_VALID_ARGUMENT(node,
+                                      direction == "forward" || direction == "reverse" ||
+                                          direction == "bidirectional")
+                    << "unknown direction: " << direction;
+                std::size_t num_directions{direction == "bidirectional" ? 2UL : 1UL};
+
+                ASSERT_VALID_ARGUMENT(node,
+                                      W->get_shape() ==
+                                          (Shape{num_directions, gates_size, input_size}))
+                    << "input W has invalid shape";
+                ASSERT_VALID_ARGUMENT(node,
+                                      R->get_shape() ==
+                                          (Shape{num_directions, gates_size, hidden_size}))
+                    << "input R has invalid shape";
+                ASSERT_VALID_ARGUMENT(
+                    node, B == nullptr || B->get_shape() == (Shape{num_directions, 2 * gates_size}))
+                    << "input B has invalid shape";
+                ASSERT_VALID_ARGUMENT(node,
+                                      initial_h == nullptr ||
+                                          initial_h->get_shape() ==
+                                              (Shape{num_directions, batch_size, hidden_size}))
+                    << "input initial_h has invalid shape";
+
+                auto activations = node.get_attribute_value<std::vector<std::string>>(
+                    "activations", std::vector<std::string>{});
+                if (activations.empty())
+                {
+                    for (std::size_t index = 0; index < num_directions; ++index)
+                    {
+                        activations.insert(std::end(activations),
+                                           std::begin(default_activations),
+                                           std::end(default_activations));
+                    }
+                }
+                ASSERT_VALID_ARGUMENT(node,
+                                      activations.size() ==
+                                          num_directions * default_activations.size())
+                    << "expected " << default_activations.size()
+                    << " activation functions per direction";
+
+                Layer layer;
+                layer.hidden_size = hidden_size;
+                layer.batch_size = batch_size;
+                layer.clip = node.get_attribute_value<float>("clip", 0.f);
+                for (std::size_t step = 0; step < seq_length; ++step)
+                {
+                    auto slice = std::make_shared<ngraph::op::Slice>(
+                        X,
+                        Coordinate{step, 0, 0},
+                        Coordinate{step + 1, batch_size, input_size});
+                    layer.X.push_back(reshape(slice, Shape{batch_size, input_size}));
+                }
+
+                const element::Type& type{X->get_element_type()};
+                for (std::size_t index = 0; index < num_directions; ++index)
+                {
+                    Direction layer_direction;
+                    layer_direction.index = index;
+                    layer_direction.reverse = (direction == "reverse") || (index == 1);
+                    layer_direction.W = get_direction(W, index);
+                    layer_direction.R = get_direction(R, index);
+                    if (B != nullptr)
+                    {
+                        auto bias = get_direction(B, index);
+                        layer_direction.Wb = std::make_shared<ngraph::op::Slice>(
+                            bias, Coordinate{0}, Coordinate{gates_size});
+                        layer_direction.Rb = std::make_shared<ngraph::op::Slice>(
+                            bias, Coordinate{gates_size}, Coordinate{2 * gates_size});
+                    }
+                    else
+                    {
+                        layer_direction.Wb = make_constant(type, Shape{gates_size}, 0);
+                        layer_direction.Rb = make_constant(type, Shape{gates_size}, 0);
+                    }
+                    if (initial_h != nullptr)
+                    {
+                        layer_direction.initial_h = get_direction(initial_h, index);
+                    }
+                    else
+                    {
+                        layer_direction.initial_h =
+                            make_constant(type, Shape{batch_size, hidden_size}, 0);
+                    }
+                    auto first = std::next(std::begin(activations),
+                                           index * default_activations.size());
+                    layer_direction.activations.assign(
+                        first, std::next(first, default_activations.size()));
+                    layer.directions.push_back(std::move(layer_direction));
+                }
+                return layer;
+            }
+
+            std::shared_ptr<ngraph::Node> get_optional_input(const Node& node, std::size_t index)
+            {
+                // An empty name stands for an omitted optional input
+                const auto& names = node.get_input_names();
+                if (index >= names.size() || names[index].get().empty())
+                {
+                    return nullptr;
+                }
+                return node.get_ng_input(index);
+            }
+
+            std::shared_ptr<ngraph::Node> get_direction(const std::shared_ptr<ngraph::Node>& node,
+                                                        std::size_t index)
+            {
+                const Shape& shape{node->get_shape()};
+                Coordinate lower(shape.size(), 0);
+                Coordinate upper{shape};
+                lower.at(0) = index;
+                upper.at(0) = index + 1;
+                return reshape(std::make_shared<ngraph::op::Slice>(node, lower, upper),
+                               Shape(std::next(std::begin(shape)), std::end(shape)));
+            }
+
+            std::shared_ptr<ngraph::Node>
+                make_constant(const element::Type& type, const Shape& shape, double value)
+            {
+                auto constant = std::make_shared<ngraph::op::Constant>(
+                    type, Shape{}, std::vector<double>{value});
+                AxisSet axes;
+                for (std::size_t axis = 0; axis < shape.size(); ++axis)
+                {
+                    axes.insert(axis);
+                }
+                return std::make_shared<ngraph::op::Broadcast>(constant, shape, axes);
+            }
+
+            std::shared_ptr<ngraph::Node> get_gate(const std::shared_ptr<ngraph::Node>& node,
+                                                   std::size_t gate,
+                                                   std::size_t hidden_size,
+                                                   std::size_t axis)
+            {
+                const Shape& shape{node->get_shape()};
+                Coordinate lower(shape.size(), 0);
+                Coordinate upper{shape};
+                lower.at(axis) = gate * hidden_size;
+                upper.at(axis) = (gate + 1) * hidden_size;
+                return std::make_shared<ngraph::op::Slice>(node, lower, upper);
+            }
+
+            std::shared_ptr<ngraph::Node> reorder_gates(const std::shared_ptr<ngraph::Node>& node,
+                                                        const std::vector<std::size_t>& order,
+                                                        std::size_t hidden_size)
+            {
+                NodeVector gates;
+                for (auto gate : order)
+                {
+                    gates.push_back(get_gate(node, gate, hidden_size, 0));
+                }
+                return concat(gates, 0);
+            }
+
+            std::shared_ptr<ngraph::Node> linear(const std::shared_ptr<ngraph::Node>& input,
+                                                 const std::shared_ptr<ngraph::Node>& weights,
+                                                 const std::shared_ptr<ngraph::Node>& bias)
+            {
+                const Shape& shape{weights->get_shape()};
+                auto weights_transposed = std::make_shared<ngraph::op::Reshape>(
+                    weights, AxisVector{1, 0}, Shape{shape.at(1), shape.at(0)});
+                auto dot = std::make_shared<ngraph::op::Dot>(input, weights_transposed);
+                auto broadcast_bias =
+                    std::make_shared<ngraph::op::Broadcast>(bias, dot->get_shape(), AxisSet{0});
+                return std::make_shared<ngraph::op::Add>(dot, broadcast_bias);
+            }
+
+            std::shared_ptr<ngraph::Node> activation(const Node& node,
+                                                     const std::string& name,
+                                                     const std::shared_ptr<ngraph::Node>& input)
+            {
+                if (name == "Sigmoid")
+                {
+                    return std::make_shared<ngraph::op::Sigmoid>(input);
+                }
+                if (name == "Tanh")
+                {
+                    return std::make_shared<ngraph::op::Tanh>(input);
+                }
+                ASSERT_IS_SUPPORTED(node, name == "Relu") << "activation function: " << name;
+                return std::make_shared<ngraph::op::Relu>(input);
+            }
+
+            std::shared_ptr<ngraph::Node> clip(const std::shared_ptr<ngraph::Node>& input,
+                                               float threshold)
+            {
+                if (threshold == 0.f)
+                {
+                    return input;
+                }
+                const element::Type& type{input->get_element_type()};
+                const Shape& shape{input->get_shape()};
+                auto max = std::make_shared<ngraph::op::Maximum>(
+                    input, make_constant(type, shape, -threshold));
+                return std::make_shared<ngraph::op::Minimum>(max,
+                                                             make_constant(type, shape, threshold));
+            }
+
+            std::shared_ptr<ngraph::Node> stack_sequence(const std::vector<NodeVector>& outputs)
+            {
+                NodeVector directions;
+                for (const auto& steps : outputs)
+                {
+                    NodeVector reshaped;
+                    for (const auto& step : steps)
+                    {
+                        const Shape& shape{step->get_shape()};
+                        reshaped.push_back(reshape(step, Shape{1, 1, shape.at(0), shape.at(1)}));
+                    }
+                    directions.push_back(concat(reshaped, 0));
+                }
+                return concat(directions, 1);
+            }
+
+            std::shared_ptr<ngraph::Node> stack_states(const NodeVector& states)
+            {
+                NodeVector reshaped;
+                for (const auto& state : states)
+                {
+                    const Shape& shape{state->get_shape()};
+                    reshaped.push_back(reshape(state, Shape{1, shape.at(0), shape.at(1)}));
+                }
+                return concat(reshaped, 0);
+            }
+
+        } // namespace recurrent
+
+    } // namespace onnx_import
+
+} // namespace ngraph
@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/node.hpp"
+#include "ngraph/node_vector.hpp"
+#include "ngraph/type/element_type.hpp"
+
+#include "core/node.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace recurrent
+        {
+            /// \brief Weights and initial state of one direction of a recurrent layer.
+            ///
+            /// Gate blocks are kept in the ONNX order of the operator.
+            struct Direction
+            {
+                std::shared_ptr<ngraph::Node> W;         // [gates * hidden_size, input_size]
+                std::shared_ptr<ngraph::Node> R;         // [gates * hidden_size, hidden_size]
+                std::shared_ptr<ngraph::Node> Wb;        // [gates * hidden_size]
+                std::shared_ptr<ngraph::Node> Rb;        // [gates * hidden_size]
+                std::shared_ptr<ngraph::Node> initial_h; // [batch_size, hidden_size]
+                std::vector<std::string> activations;
+                std::size_t index;
+                bool reverse;
+            };
+
+            /// \brief Inputs and attributes shared by the ONNX RNN, GRU and LSTM operators.
+            struct Layer
+            {
+                NodeVector X; // one [batch_size, input_size] node per time step
+                std::vector<Direction> directions;
+                std::size_t hidden_size;
+                std::size_t batch_size;
+                float clip; // zero when the gate inputs are not clipped
+            };
+
+            /// \brief Read the inputs and attributes common to all recurrent operators.
+            ///
+            /// \param node The ONNX recurrent operator.
+            /// \param gates_count Number of gates packed in the weights of the operator.
+            /// \param default_activations Activation functions of one direction used when the
+            ///        node has no 'activations' attribute.
+            Layer get_layer(const Node& node,
+                            std::size_t gates_count,
+                            const std::vector<std::string>& default_activations);
+
+            /// \brief Return the optional input at the given index, or nullptr when omitted.
+            std::shared_ptr<ngraph::Node> get_optional_input(const Node& node, std::size_t index);
+
+            /// \brief Take one direction of an ONNX [num_directions, ...] tensor.
+            std::shared_ptr<ngraph::Node> get_direction(const std::shared_ptr<ngraph::Node>& node,
+                                                        std::size_t index);
+
+            /// \brief Broadcast a scalar constant to the given shape.
+            std::shared_ptr<ngraph::Node>
+                make_constant(const element::Type& type, const Shape& shape, double value);
+
+            /// \brief Take the block of one gate along an axis of a packed tensor.
+            std::shared_ptr<ngraph::Node> get_gate(const std::shared_ptr<ngraph::Node>& node,
+                                                   std::size_t gate,
+                                                   std::size_t hidden_size,
+                                                   std::size_t axis);
+
+            /// \brief Rearrange the gate blocks along the first axis of a packed tensor.
+            ///
+            /// \param order Gate indices of the input in the order of the output.
+            std::shared_ptr<ngraph::Node> reorder_gates(const std::shared_ptr<ngraph::Node>& node,
+                                                        const std::vector<std::size_t>& order,
+                                                        std::size_t hidden_size);
+
+            /// \brief Compute input * transpose(weights) + bias, bias broadcast over the batch.
+            std::shared_ptr<ngraph::Node> linear(const std::shared_ptr<ngraph::Node>& input,
+                                                 const std::shared_ptr<ngraph::Node>& weights,
+                                                 const std::shared_ptr<ngraph::Node>& bias);
+
+            /// \brief Apply an ONNX activation function by name.
+            std::shared_ptr<ngraph::Node> activation(const Node& node,
+                                                     const std::string& name,
+                                                     const std::shared_ptr<ngraph::Node>& input);
+
+            /// \brief Clip the input to [-threshold, threshold], or return it when threshold is 0.
+            std::shared_ptr<ngraph::Node> clip(const std::shared_ptr<ngraph::Node>& input,
+                                               float threshold);
+
+            /// \brief Stack per time step outputs of all directions into the ONNX Y output.
+            ///
+            /// \param outputs Outputs of each direction in time step order.
+            ///
+            /// \return Node of shape [seq_length, num_directions, batch_size, hidden_size].
+            std::shared_ptr<ngraph::Node> stack_sequence(const std::vector<NodeVector>& outputs);
+
+            /// \brief Stack final states of all directions into the ONNX Y_h or Y_c output.
+            ///
+            /// \return Node of shape [num_directions, batch_size, hidden_size].
+            std::shared_ptr<ngraph::Node> stack_states(const NodeVector& states);
+
+        } // namespace recurrent
+
+    } // namespace onnx_import
+
+} // namespace ngraph
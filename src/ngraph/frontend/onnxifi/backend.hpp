@@ -52,6 +52,13 @@ namespace ngraph
                 return get().compile(function);
             }
 
+            std::shared_ptr<runtime::TensorView> create_tensor(const element::Type& element_type,
+                                                               const Shape& shape,
+                                                               void* memory_pointer) const
+            {
+                return get().create_tensor(element_type, shape, memory_pointer);
+            }
+
             bool call(const std::shared_ptr<Function>& function,
                       const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                       const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) const
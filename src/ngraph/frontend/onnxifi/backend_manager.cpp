@@ -14,8 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstdlib>   // std::size_t, std::uintptr_t
-#include <stdexcept> // std::invalid_agrument, std::out_of_rage
+#include <cstdlib> // std::size_t, std::uintptr_t
 
 #include <onnxifi.h>
 
@@ -49,13 +48,13 @@ namespace ngraph
         {
             if (count == nullptr)
             {
-                throw std::invalid_argument{"null pointer"};
+                throw error::null_pointer{};
             }
             std::size_t requested{*count};
             *count = m_registered_backends.size();
             if ((requested < *count) || (backend_ids == nullptr))
             {
-                throw std::length_error{"not enough space"};
+                throw error::not_enough_space{};
             }
             {
                 std::lock_guard<decltype(m_mutex)> lock{m_mutex};
@@ -25,6 +25,7 @@
 #include "ngraph/runtime/backend.hpp"
 
 #include "backend.hpp"
+#include "exceptions.hpp"
 
 namespace ngraph
 {
@@ -55,9 +56,25 @@ namespace ngraph
                 return instance().get_backend(backend_id);
             }
 
+            static void init(::onnxBackendID backend_id, ::onnxBackend* backend)
+            {
+                instance().init_backend(backend_id, backend);
+            }
+
+            static void release(::onnxBackend backend) { instance().release_backend(backend); }
+
+            /// \brief Get the backend behind a handle returned by init()
+            static const Backend& from_handle(::onnxBackend backend)
+            {
+                return instance().get_initialized_backend(backend);
+            }
+
         private:
             mutable std::mutex m_mutex{};
             std::map<std::uintptr_t, Backend> m_registered_backends{};
+            // Each onnxInitBackend() call hands out the same handle for a backend ID, so count
+            // the initializations and keep the handle valid until each one is released
+            std::map<const Backend*, std::size_t> m_initialized_backends{};
 
             BackendManager();
 
@@ -90,6 +107,47 @@ namespace ngraph
             {
                 return get_backend(reinterpret_cast<std::uintptr_t>(id));
             }
+
+            void init_backend(::onnxBackendID id, ::onnxBackend* backend)
+            {
+                if (backend == nullptr)
+                {
+                    throw error::null_pointer{};
+                }
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto it = m_registered_backends.find(reinterpret_cast<std::uintptr_t>(id));
+                if (it == std::end(m_registered_backends))
+                {
+                    throw error::invalid_id{};
+                }
+                ++m_initialized_backends[&it->second];
+                *backend = reinterpret_cast<::onnxBackend>(&it->second);
+            }
+
+            void release_backend(::onnxBackend backend)
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto it = m_initialized_backends.find(reinterpret_cast<const Backend*>(backend));
+                if (it == std::end(m_initialized_backends))
+                {
+                    throw error::invalid_backend{};
+                }
+                if (--it->second == 0)
+                {
+                    m_initialized_backends.erase(it);
+                }
+            }
+
+            const Backend& get_initialized_backend(::onnxBackend backend) const
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto it = m_initialized_backends.find(reinterpret_cast<const Backend*>(backend));
+                if (it == std::end(m_initialized_backends))
+                {
+                    throw error::invalid_backend{};
+                }
+                return *it->first;
+            }
         };
 
     } // namespace onnxifi
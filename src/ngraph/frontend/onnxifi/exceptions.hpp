@@ -0,0 +1,211 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string> // std::string
+
+#include <onnxifi.h>
+
+#include "ngraph/except.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace error
+        {
+            /// \brief Failure reported back to the ONNXIFI caller as the given status code
+            class status : public ngraph_error
+            {
+            public:
+                status(::onnxStatus code, const std::string& what)
+                    : ngraph_error{what}
+                    , m_code{code}
+                {
+                }
+
+                ::onnxStatus get_code() const { return m_code; }
+            private:
+                ::onnxStatus m_code;
+            };
+
+            struct null_pointer : status
+            {
+                null_pointer()
+                    : status{ONNXIFI_STATUS_INVALID_POINTER, "null pointer"}
+                {
+                }
+            };
+
+            struct not_enough_space : status
+            {
+                not_enough_space()
+                    : status{ONNXIFI_STATUS_FALLBACK, "not enough space"}
+                {
+                }
+            };
+
+            struct invalid_id : status
+            {
+                invalid_id()
+                    : status{ONNXIFI_STATUS_INVALID_ID, "invalid backend ID"}
+                {
+                }
+            };
+
+            struct invalid_backend : status
+            {
+                invalid_backend()
+                    : status{ONNXIFI_STATUS_INVALID_BACKEND, "invalid backend handle"}
+                {
+                }
+            };
+
+            struct invalid_graph : status
+            {
+                invalid_graph()
+                    : status{ONNXIFI_STATUS_INVALID_GRAPH, "invalid graph handle"}
+                {
+                }
+            };
+
+            struct invalid_event : status
+            {
+                invalid_event()
+                    : status{ONNXIFI_STATUS_INVALID_EVENT, "invalid event handle"}
+                {
+                }
+            };
+
+            struct invalid_state : status
+            {
+                explicit invalid_state(const std::string& what)
+                    : status{ONNXIFI_STATUS_INVALID_STATE, what}
+                {
+                }
+            };
+
+            struct unsupported_tag : status
+            {
+                unsupported_tag()
+                    : status{ONNXIFI_STATUS_UNSUPPORTED_TAG, "unsupported structure tag"}
+                {
+                }
+            };
+
+            struct invalid_model : status
+            {
+                explicit invalid_model(const std::string& what)
+                    : status{ONNXIFI_STATUS_INVALID_MODEL, what}
+                {
+                }
+            };
+
+            struct unsupported_fence_type : status
+            {
+                unsupported_fence_type()
+                    : status{ONNXIFI_STATUS_UNSUPPORTED_FENCE_TYPE, "unsupported fence type"}
+                {
+                }
+            };
+
+            namespace tensor
+            {
+                struct invalid_name : status
+                {
+                    invalid_name()
+                        : status{ONNXIFI_STATUS_INVALID_NAME, "tensor has no name"}
+                    {
+                    }
+                };
+
+                struct unidentified_name : status
+                {
+                    explicit unidentified_name(const std::string& name)
+                        : status{ONNXIFI_STATUS_UNIDENTIFIED_NAME, "unknown tensor: " + name}
+                    {
+                    }
+                };
+
+                struct unbound_name : status
+                {
+                    explicit unbound_name(const std::string& name)
+                        : status{ONNXIFI_STATUS_UNIDENTIFIED_NAME, "tensor not bound: " + name}
+                    {
+                    }
+                };
+
+                struct invalid_shape : status
+                {
+                    explicit invalid_shape(const std::string& name)
+                        : status{ONNXIFI_STATUS_INVALID_SHAPE, "invalid shape of tensor: " + name}
+                    {
+                    }
+                };
+
+                struct mismatching_shape : status
+                {
+                    explicit mismatching_shape(const std::string& name)
+                        : status{ONNXIFI_STATUS_MISMATCHING_SHAPE,
+                                 "mismatching shape of tensor: " + name}
+                    {
+                    }
+                };
+
+                struct unsupported_datatype : status
+                {
+                    explicit unsupported_datatype(const std::string& name)
+                        : status{ONNXIFI_STATUS_UNSUPPORTED_DATATYPE,
+                                 "unsupported data type of tensor: " + name}
+                    {
+                    }
+                };
+
+                struct mismatching_datatype : status
+                {
+                    explicit mismatching_datatype(const std::string& name)
+                        : status{ONNXIFI_STATUS_MISMATCHING_DATATYPE,
+                                 "mismatching data type of tensor: " + name}
+                    {
+                    }
+                };
+
+                struct invalid_memory_type : status
+                {
+                    explicit invalid_memory_type(const std::string& name)
+                        : status{ONNXIFI_STATUS_INVALID_MEMORY_TYPE,
+                                 "invalid memory type of tensor: " + name}
+                    {
+                    }
+                };
+
+                struct invalid_memory_location : status
+                {
+                    explicit invalid_memory_location(const std::string& name)
+                        : status{ONNXIFI_STATUS_INVALID_MEMORY_LOCATION,
+                                 "invalid memory location of tensor: " + name}
+                    {
+                    }
+                };
+
+            } // namespace tensor
+
+        } // namespace error
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,219 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint> // std::uint32_t, std::uintptr_t
+#include <sstream> // std::istringstream
+#include <string>  // std::string
+
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+
+#include "exceptions.hpp"
+#include "graph.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace
+        {
+            element::Type get_element_type(const ::onnxTensorDescriptorV1& descriptor)
+            {
+                switch (descriptor.dataType)
+                {
+                case ONNXIFI_DATATYPE_FLOAT32: return element::f32;
+                case ONNXIFI_DATATYPE_FLOAT64: return element::f64;
+                case ONNXIFI_DATATYPE_INT8: return element::i8;
+                case ONNXIFI_DATATYPE_INT16: return element::i16;
+                case ONNXIFI_DATATYPE_INT32: return element::i32;
+                case ONNXIFI_DATATYPE_INT64: return element::i64;
+                case ONNXIFI_DATATYPE_UINT8: return element::u8;
+                case ONNXIFI_DATATYPE_UINT16: return element::u16;
+                case ONNXIFI_DATATYPE_UINT32: return element::u32;
+                case ONNXIFI_DATATYPE_UINT64: return element::u64;
+                default: throw error::tensor::unsupported_datatype{descriptor.name};
+                }
+            }
+
+            /// \brief Find the node the tensor descriptor refers to by its name
+            template <typename T>
+            std::size_t get_index(const std::vector<std::shared_ptr<T>>& nodes,
+                                  const ::onnxTensorDescriptorV1& descriptor)
+            {
+                if (descriptor.tag != ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1)
+                {
+                    throw error::unsupported_tag{};
+                }
+                if (descriptor.name == nullptr)
+                {
+                    throw error::tensor::invalid_name{};
+                }
+                for (std::size_t i = 0; i < nodes.size(); ++i)
+                {
+                    if (nodes[i]->get_friendly_name() == descriptor.name)
+                    {
+                        return i;
+                    }
+                }
+                throw error::tensor::unidentified_name{descriptor.name};
+            }
+
+            /// \brief Check the tensor descriptor matches the node and return its buffer
+            void* get_buffer(const ::onnxTensorDescriptorV1& descriptor, const ngraph::Node& node)
+            {
+                if (descriptor.memoryType != ONNXIFI_MEMORY_TYPE_CPU)
+                {
+                    throw error::tensor::invalid_memory_type{descriptor.name};
+                }
+                if ((descriptor.dimensions != 0) && (descriptor.shape == nullptr))
+                {
+                    throw error::tensor::invalid_shape{descriptor.name};
+                }
+                if (get_element_type(descriptor) != node.get_element_type())
+                {
+                    throw error::tensor::mismatching_datatype{descriptor.name};
+                }
+                if (Shape(descriptor.shape, descriptor.shape + descriptor.dimensions) !=
+                    node.get_shape())
+                {
+                    throw error::tensor::mismatching_shape{descriptor.name};
+                }
+                if (descriptor.buffer == 0)
+                {
+                    throw error::tensor::invalid_memory_location{descriptor.name};
+                }
+                return reinterpret_cast<void*>(static_cast<std::uintptr_t>(descriptor.buffer));
+            }
+
+            /// \brief Wrap the caller buffers into backend tensors, one per node
+            template <typename T>
+            std::vector<std::shared_ptr<runtime::TensorView>>
+                bind_tensors(const Backend& backend,
+                             const std::vector<std::shared_ptr<T>>& nodes,
+                             const ::onnxTensorDescriptorV1* descriptors,
+                             std::uint32_t count)
+            {
+                if ((count != 0) && (descriptors == nullptr))
+                {
+                    throw error::null_pointer{};
+                }
+                std::vector<std::shared_ptr<runtime::TensorView>> tensors(nodes.size());
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    std::size_t index{get_index(nodes, descriptors[i])};
+                    const auto& node = nodes[index];
+                    tensors[index] = backend.create_tensor(node->get_element_type(),
+                                                           node->get_shape(),
+                                                           get_buffer(descriptors[i], *node));
+                }
+                for (std::size_t i = 0; i < nodes.size(); ++i)
+                {
+                    if (tensors[i] == nullptr)
+                    {
+                        throw error::tensor::unbound_name{nodes[i]->get_friendly_name()};
+                    }
+                }
+                return tensors;
+            }
+
+        } // namespace <anonymous>
+
+        Graph::Graph(const Backend& backend,
+                     const void* model,
+                     std::size_t model_size,
+                     const ::onnxTensorDescriptorV1* weights,
+                     std::uint32_t weights_count)
+            : m_backend{backend}
+        {
+            if ((model == nullptr) || ((weights_count != 0) && (weights == nullptr)))
+            {
+                throw error::null_pointer{};
+            }
+            std::istringstream sin{std::string{static_cast<const char*>(model), model_size}};
+            std::vector<std::shared_ptr<Function>> functions;
+            try
+            {
+                functions = onnx_import::load_onnx_model(sin);
+            }
+            catch (const ngraph_error& e)
+            {
+                throw error::invalid_model{e.what()};
+            }
+            if (functions.empty())
+            {
+                throw error::invalid_model{"model has no outputs"};
+            }
+
+            // Functions imported from one model share their parameters, so the results can
+            // be gathered into a single function computing all graph outputs at once.
+            ResultVector results;
+            for (const auto& function : functions)
+            {
+                results.push_back(function->get_results().front());
+            }
+            op::ParameterVector parameters{functions.front()->get_parameters()};
+
+            for (std::uint32_t i = 0; i < weights_count; ++i)
+            {
+                std::size_t index{get_index(parameters, weights[i])};
+                const auto& parameter = parameters[index];
+                auto constant = std::make_shared<op::Constant>(parameter->get_element_type(),
+                                                               parameter->get_shape(),
+                                                               get_buffer(weights[i], *parameter));
+                if (!parameter->get_users().empty())
+                {
+                    replace_node(parameter, constant);
+                }
+                parameters.erase(std::begin(parameters) + index);
+            }
+
+            m_function = std::make_shared<Function>(results, parameters);
+            if (!m_backend.compile(m_function))
+            {
+                throw error::status{ONNXIFI_STATUS_INTERNAL_ERROR, "graph compilation failed"};
+            }
+        }
+
+        void Graph::set_io(std::uint32_t inputs_count,
+                           const ::onnxTensorDescriptorV1* inputs,
+                           std::uint32_t outputs_count,
+                           const ::onnxTensorDescriptorV1* outputs)
+        {
+            auto bound_inputs =
+                bind_tensors(m_backend, m_function->get_parameters(), inputs, inputs_count);
+            auto bound_outputs =
+                bind_tensors(m_backend, m_function->get_results(), outputs, outputs_count);
+            m_inputs = std::move(bound_inputs);
+            m_outputs = std::move(bound_outputs);
+        }
+
+        void Graph::run() const
+        {
+            // Every function has at least one result, so no outputs means no binding yet
+            if (m_outputs.empty())
+            {
+                throw error::invalid_state{"graph inputs and outputs are not set"};
+            }
+            if (!m_backend.call(m_function, m_outputs, m_inputs))
+            {
+                throw error::status{ONNXIFI_STATUS_INTERNAL_ERROR, "graph execution failed"};
+            }
+        }
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <memory>  // std::shared_ptr
+#include <vector>  // std::vector
+
+#include <onnxifi.h>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+#include "backend.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI graph: an ONNX model compiled for one backend
+        ///
+        /// Caller buffers are bound once by set_io() as tensors wrapping the caller memory,
+        /// so each run() executes the compiled function in place without allocating or
+        /// copying tensors.
+        class Graph
+        {
+        public:
+            Graph(const Graph&) = delete;
+            Graph& operator=(const Graph&) = delete;
+
+            Graph(Graph&&) = delete;
+            Graph& operator=(Graph&&) = delete;
+
+            /// \brief Import and compile an ONNX model
+            /// \param backend The backend to compile and run the model on
+            /// \param model Serialized ONNX ModelProto
+            /// \param model_size Size of the serialized model in bytes
+            /// \param weights Descriptors of static inputs, folded into the graph as constants.
+            ///     The weights are copied and need not outlive the constructor.
+            /// \param weights_count Number of weight descriptors
+            Graph(const Backend& backend,
+                  const void* model,
+                  std::size_t model_size,
+                  const ::onnxTensorDescriptorV1* weights,
+                  std::uint32_t weights_count);
+
+            /// \brief Bind caller buffers to all graph inputs and outputs, replacing any
+            ///     previous binding. The buffers must stay valid while the graph is run.
+            void set_io(std::uint32_t inputs_count,
+                        const ::onnxTensorDescriptorV1* inputs,
+                        std::uint32_t outputs_count,
+                        const ::onnxTensorDescriptorV1* outputs);
+
+            /// \brief Execute the graph on the bound buffers
+            void run() const;
+
+            const Backend& get_backend() const { return m_backend; }
+        private:
+            const Backend& m_backend;
+            std::shared_ptr<Function> m_function{nullptr};
+            std::vector<std::shared_ptr<runtime::TensorView>> m_inputs{};
+            std::vector<std::shared_ptr<runtime::TensorView>> m_outputs{};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -21,33 +21,44 @@
 #include <onnxifi.h>
 
 #include "backend_manager.hpp"
+#include "event.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+
+using namespace ngraph::onnxifi;
+
+namespace
+{
+    /// \brief Run an entry point body, mapping the exceptions it throws to an ONNXIFI status
+    template <typename F>
+    onnxStatus translate(F&& f)
+    {
+        try
+        {
+            f();
+            return ONNXIFI_STATUS_SUCCESS;
+        }
+        catch (const error::status& e)
+        {
+            return e.get_code();
+        }
+        catch (const std::bad_alloc&)
+        {
+            return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        }
+        catch (...)
+        {
+            return ONNXIFI_STATUS_INTERNAL_ERROR;
+        }
+    }
+}
 
 extern "C" {
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
     onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
 {
-    try
-    {
-        ngraph::onnxifi::BackendManager::get_backend_ids(backendIDs, numBackends);
-        return ONNXIFI_STATUS_SUCCESS;
-    }
-    catch (const std::invalid_argument&)
-    {
-        return ONNXIFI_STATUS_INVALID_POINTER;
-    }
-    catch (const std::bad_alloc&)
-    {
-        return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
-    }
-    catch (const std::length_error&)
-    {
-        return ONNXIFI_STATUS_FALLBACK;
-    }
-    catch (...)
-    {
-        return ONNXIFI_STATUS_INTERNAL_ERROR;
-    }
+    return translate([&] { BackendManager::get_backend_ids(backendIDs, numBackends); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -71,33 +82,58 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxGetBackendCompati
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitBackend(
     onnxBackendID backendID, const uint64_t* auxPropertiesList, onnxBackend* backend)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] { BackendManager::init(backendID, backend); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend backend)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return translate([&] { BackendManager::release(backend); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend backend,
                                                                          onnxEvent* event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] {
+        BackendManager::from_handle(backend);
+        if (event == nullptr)
+        {
+            throw error::null_pointer{};
+        }
+        *event = reinterpret_cast<onnxEvent>(new Event{});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] {
+        if (event == nullptr)
+        {
+            throw error::invalid_event{};
+        }
+        reinterpret_cast<Event*>(event)->signal();
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] {
+        if (event == nullptr)
+        {
+            throw error::invalid_event{};
+        }
+        reinterpret_cast<Event*>(event)->wait();
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return translate([&] {
+        if (event == nullptr)
+        {
+            throw error::invalid_event{};
+        }
+        delete reinterpret_cast<Event*>(event);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -109,7 +145,15 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
                   const onnxTensorDescriptorV1* weightDescriptors,
                   onnxGraph* graph)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] {
+        const Backend& ng_backend = BackendManager::from_handle(backend);
+        if (graph == nullptr)
+        {
+            throw error::null_pointer{};
+        }
+        *graph = reinterpret_cast<onnxGraph>(
+            new Graph{ng_backend, onnxModel, onnxModelSize, weightDescriptors, weightsCount});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -119,18 +163,71 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
                    std::uint32_t outputsCount,
                    const onnxTensorDescriptorV1* outputDescriptors)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] {
+        if (graph == nullptr)
+        {
+            throw error::invalid_graph{};
+        }
+        reinterpret_cast<Graph*>(graph)->set_io(
+            inputsCount, inputDescriptors, outputsCount, outputDescriptors);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxRunGraph(
     onnxGraph graph, const onnxMemoryFenceV1* inputFence, onnxMemoryFenceV1* outputFence)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return translate([&] {
+        if (graph == nullptr)
+        {
+            throw error::invalid_graph{};
+        }
+        if ((inputFence == nullptr) || (outputFence == nullptr))
+        {
+            throw error::null_pointer{};
+        }
+        if ((inputFence->tag != ONNXIFI_TAG_MEMORY_FENCE_V1) ||
+            (outputFence->tag != ONNXIFI_TAG_MEMORY_FENCE_V1))
+        {
+            throw error::unsupported_tag{};
+        }
+        if ((outputFence->type != ONNXIFI_SYNCHRONIZATION_EVENT) &&
+            (outputFence->type != ONNXIFI_SYNCHRONIZATION_IMPLICIT))
+        {
+            throw error::unsupported_fence_type{};
+        }
+        switch (inputFence->type)
+        {
+        case ONNXIFI_SYNCHRONIZATION_EVENT:
+            if (inputFence->event == nullptr)
+            {
+                throw error::invalid_event{};
+            }
+            reinterpret_cast<Event*>(inputFence->event)->wait();
+            break;
+        case ONNXIFI_SYNCHRONIZATION_IMPLICIT: break;
+        default: throw error::unsupported_fence_type{};
+        }
+
+        // The graph is executed synchronously, so the output event is signalled on return
+        reinterpret_cast<Graph*>(graph)->run();
+        if (outputFence->type == ONNXIFI_SYNCHRONIZATION_EVENT)
+        {
+            auto event = new Event{};
+            event->signal();
+            outputFence->event = reinterpret_cast<onnxEvent>(event);
+        }
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph graph)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return translate([&] {
+        if (graph == nullptr)
+        {
+            throw error::invalid_graph{};
+        }
+        delete reinterpret_cast<Graph*>(graph);
+    });
 }
 
 } /* extern "C" */
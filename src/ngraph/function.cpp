@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -34,6 +35,10 @@ Function::Function(const ResultVector& results,
     : m_results(results)
     , m_parameters(parameters)
     , m_temporary_pool_size(0)
+    , m_has_batch_axis(false)
+    , m_batch_axis(0)
+    , m_batch_size(0)
+    , m_ordered_ops_replacement_count(0)
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
@@ -47,6 +52,10 @@ Function::Function(const NodeVector& results,
     : m_results(results.size())
     , m_parameters(parameters)
     , m_temporary_pool_size(0)
+    , m_has_batch_axis(false)
+    , m_batch_axis(0)
+    , m_batch_size(0)
+    , m_ordered_ops_replacement_count(0)
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
@@ -85,26 +94,38 @@ void Function::init()
 {
     validate_nodes_and_infer_types();
 
+    unordered_set<const Node*> parameters;
+    for (auto& parameter : m_parameters)
+    {
+        parameters.insert(parameter.get());
+    }
     traverse_nodes(this, [&](shared_ptr<Node> node) {
-        std::shared_ptr<op::Parameter> p = std::dynamic_pointer_cast<op::Parameter>(node);
-        if (nullptr != p)
+        if (node->is_parameter() && parameters.count(node.get()) == 0)
         {
-            auto it = std::find_if(m_parameters.begin(),
-                                   m_parameters.end(),
-                                   [p](std::shared_ptr<op::Parameter> q) { return (p == q); });
-            if (it == m_parameters.end())
-            {
-                throw ngraph_error("Function references undeclared parameter");
-            }
+            throw ngraph_error("Function references undeclared parameter");
         }
     });
 }
 
 std::list<shared_ptr<Node>> Function::get_ordered_ops()
 {
+    if (!m_ordered_ops.empty())
+    {
+        if (m_ordered_ops_replacement_count == descriptor::Input::get_replacement_count())
+        {
+            return m_ordered_ops;
+        }
+        m_ordered_ops.clear();
+    }
     return topological_sort(get_ops());
 }
 
+void Function::set_ordered_ops(const list<shared_ptr<Node>>& ordered_ops)
+{
+    m_ordered_ops = ordered_ops;
+    m_ordered_ops_replacement_count = descriptor::Input::get_replacement_count();
+}
+
 const std::string& Function::get_friendly_name() const
 {
     if (m_name.empty())
@@ -141,6 +162,76 @@ void Function::set_temporary_pool_size(size_t size)
     m_temporary_pool_size = size;
 }
 
+void Function::set_batch_axis(size_t axis, const op::ParameterVector& batched_parameters)
+{
+    vector<bool> batched(m_parameters.size(), batched_parameters.empty());
+    for (auto& parameter : batched_parameters)
+    {
+        auto it = find(m_parameters.begin(), m_parameters.end(), parameter);
+        if (it == m_parameters.end())
+        {
+            throw ngraph_error("Batched parameter is not a parameter of the function");
+        }
+        batched[it - m_parameters.begin()] = true;
+    }
+
+    size_t batch_size = 0;
+    auto check_shape = [&](const Shape& shape, const string& what) {
+        if (axis >= shape.size())
+        {
+            throw ngraph_error("Batch axis " + to_string(axis) + " is out of range for " + what);
+        }
+        if (batch_size != 0 && shape[axis] != batch_size)
+        {
+            throw ngraph_error("Batch axis extent of " + what + " does not match other tensors");
+        }
+        batch_size = shape[axis];
+    };
+    for (size_t i = 0; i < m_parameters.size(); i++)
+    {
+        if (batched[i])
+        {
+            check_shape(m_parameters[i]->get_shape(), "parameter " + to_string(i));
+        }
+    }
+    for (size_t i = 0; i < m_results.size(); i++)
+    {
+        check_shape(m_results[i]->get_shape(), "result " + to_string(i));
+    }
+    if (batch_size == 0)
+    {
+        throw ngraph_error("Batch axis must have a non-zero extent");
+    }
+
+    m_has_batch_axis = true;
+    m_batch_axis = axis;
+    m_batch_size = batch_size;
+    m_batched_parameters = batched;
+}
+
+size_t Function::get_batch_axis() const
+{
+    if (!m_has_batch_axis)
+    {
+        throw ngraph_error("Function " + get_name() + " has no batch axis");
+    }
+    return m_batch_axis;
+}
+
+size_t Function::get_batch_size() const
+{
+    if (!m_has_batch_axis)
+    {
+        throw ngraph_error("Function " + get_name() + " has no batch axis");
+    }
+    return m_batch_size;
+}
+
+bool Function::is_batched_parameter(size_t i) const
+{
+    return m_has_batch_axis && m_batched_parameters.at(i);
+}
+
 std::ostream& operator<<(std::ostream& out, const Function& f)
 {
     out << "Function(" << f.get_name() << ")";
@@ -75,6 +75,11 @@ namespace ngraph
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops() const;
         std::list<std::shared_ptr<Node>> get_ordered_ops();
+        /// \brief Set the order get_ordered_ops() returns, e.g. a schedule chosen by a pass.
+        ///
+        /// The order is dropped once any graph is rewritten, i.e. once an input is connected to
+        /// another output.
+        void set_ordered_ops(const std::list<std::shared_ptr<Node>>& ordered_ops);
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -84,10 +89,33 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Declare the batch axis used by runtime::Backend::call_batch.
+        ///
+        /// Batched calls concatenate independent requests along `axis` of every result and of
+        /// every parameter in `batched_parameters`; the other parameters are shared by all
+        /// requests. The extent of `axis` is the largest batch a single call can run.
+        /// Backends may also run other extents with a specialization of the function, see
+        /// ngraph::specialize_batch.
+        /// \param axis The batch axis
+        /// \param batched_parameters The batched parameters, all parameters if empty
+        void set_batch_axis(size_t axis, const op::ParameterVector& batched_parameters = {});
+        bool has_batch_axis() const { return m_has_batch_axis; }
+        size_t get_batch_axis() const;
+        /// Return the extent of the batch axis
+        size_t get_batch_size() const;
+        /// Return true if parameter i is concatenated by batched calls
+        bool is_batched_parameter(size_t i) const;
+
     protected:
         ResultVector m_results;
         op::ParameterVector m_parameters;
         size_t m_temporary_pool_size;
+        bool m_has_batch_axis;
+        size_t m_batch_axis;
+        size_t m_batch_size;
+        std::vector<bool> m_batched_parameters;
+        std::list<std::shared_ptr<Node>> m_ordered_ops;
+        size_t m_ordered_ops_replacement_count;
 
     private:
         Function(const Function&) = delete;
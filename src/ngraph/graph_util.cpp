@@ -27,11 +27,27 @@
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/node_vector.hpp"
+#include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/lrn.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/not.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/result_vector.hpp"
+#include "ngraph/op/reverse.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/placement.hpp"
 #include "ngraph/util.hpp"
 
@@ -142,8 +158,7 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
     for (size_t i = 0; i < target->get_outputs().size(); i++)
     {
         auto& target_output = target->get_outputs().at(i);
-        std::set<ngraph::descriptor::Input*> copy_inputs{begin(target_output.get_inputs()),
-                                                         end(target_output.get_inputs())};
+        auto copy_inputs = target_output.get_inputs();
         for (auto input : copy_inputs)
         {
             input->replace_output(replacement->get_outputs().at(i));
@@ -220,7 +235,8 @@ std::list<std::shared_ptr<ngraph::Node>>
         {
             // get (already) cloned arguments and clone the node
             NodeVector cloned_args;
-            for (auto arg : node->get_arguments())
+            cloned_args.reserve(node->get_input_size());
+            for (auto& arg : node->get_arguments())
             {
                 cloned_args.push_back(node_map.get(arg));
             }
@@ -271,6 +287,135 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
     return std::make_shared<ngraph::Function>(cloned_results, cloned_params);
 }
 
+std::shared_ptr<ngraph::Function> ngraph::specialize_batch(const ngraph::Function& func,
+                                                           size_t batch_size)
+{
+    size_t axis = func.get_batch_axis();
+    const op::ParameterVector& parameters = func.get_parameters();
+    NodeMap node_map;
+    op::ParameterVector batched_parameters;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (func.is_batched_parameter(i))
+        {
+            Shape shape = parameters[i]->get_shape();
+            shape.at(axis) = batch_size;
+            auto parameter = std::make_shared<op::Parameter>(
+                parameters[i]->get_element_type(), shape, parameters[i]->get_cacheable());
+            node_map.add(parameters[i], parameter);
+            batched_parameters.push_back(parameter);
+        }
+    }
+
+    auto specialized = clone_function(func, node_map);
+    for (size_t i = 0; i < specialized->get_output_size(); i++)
+    {
+        const Shape& shape = specialized->get_output_shape(i);
+        if (axis >= shape.size() || shape[axis] != batch_size)
+        {
+            throw ngraph_error("Result " + std::to_string(i) + " of Function " + func.get_name() +
+                               " does not carry the batch axis");
+        }
+    }
+    specialized->set_batch_axis(axis, batched_parameters);
+    return specialized;
+}
+
+// Axes all above axis leave it at the same position
+static bool all_axes_above(const AxisSet& axes, size_t axis)
+{
+    return axes.empty() || *axes.begin() > axis;
+}
+
+// true if node computes each slice of axis of its output from the same slice of its batched
+// arguments, which carry the batch on axis as well
+static bool keeps_batch_slices(const shared_ptr<Node>& node,
+                               size_t axis,
+                               const unordered_set<const Node*>& batched)
+{
+    auto is_batched = [&](size_t i) { return batched.count(node->get_argument(i).get()) != 0; };
+
+    if (auto softmax = dynamic_pointer_cast<op::Softmax>(node))
+    {
+        return softmax->get_axes().count(axis) == 0;
+    }
+    if (dynamic_pointer_cast<op::LRN>(node))
+    {
+        // Normalizes across the channel axis
+        return axis != 1;
+    }
+    if (dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwiseComparison>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwiseLogical>(node) ||
+        dynamic_pointer_cast<op::Convert>(node) || dynamic_pointer_cast<op::Not>(node) ||
+        dynamic_pointer_cast<op::Select>(node) ||
+        dynamic_pointer_cast<op::GetOutputElement>(node) || node->is_output())
+    {
+        return true;
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(node))
+    {
+        return all_axes_above(reduction->get_reduction_axes(), axis);
+    }
+    if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        return all_axes_above(broadcast->get_broadcast_axes(), axis);
+    }
+    if (auto reverse = dynamic_pointer_cast<op::Reverse>(node))
+    {
+        return reverse->get_reversed_axes().count(axis) == 0;
+    }
+    if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+    {
+        // Rows of the first argument times a shared second argument
+        return !is_batched(1) &&
+               axis + dot->get_reduction_axes_count() < node->get_input_shape(0).size();
+    }
+    if (dynamic_pointer_cast<op::Convolution>(node))
+    {
+        return axis == 0 && !is_batched(1);
+    }
+    if (dynamic_pointer_cast<op::MaxPool>(node) || dynamic_pointer_cast<op::AvgPool>(node))
+    {
+        return axis == 0;
+    }
+    return false;
+}
+
+bool ngraph::has_independent_batch_slices(const ngraph::Function& func)
+{
+    size_t axis = func.get_batch_axis();
+    unordered_set<const Node*> batched;
+    for (size_t i = 0; i < func.get_parameters().size(); i++)
+    {
+        if (func.is_batched_parameter(i))
+        {
+            batched.insert(func.get_parameters()[i].get());
+        }
+    }
+
+    for (auto node : topological_sort(func.get_ops()))
+    {
+        bool uses_batch = false;
+        for (auto arg : node->get_arguments())
+        {
+            uses_batch = uses_batch || batched.count(arg.get()) != 0;
+        }
+        if (!uses_batch)
+        {
+            continue;
+        }
+        if (!keeps_batch_slices(node, axis, batched))
+        {
+            NGRAPH_DEBUG << node->get_name() << " combines slices of the batch axis";
+            return false;
+        }
+        batched.insert(node.get());
+    }
+    return true;
+}
+
 bool ngraph::is_equal_to_const_value(std::string const_value, std::shared_ptr<Node> reduce_constant)
 {
     if (auto rc = dynamic_pointer_cast<ngraph::op::Constant>(reduce_constant))
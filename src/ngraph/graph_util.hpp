@@ -59,12 +59,15 @@ namespace ngraph
         std::deque<ngraph::Node*> independent_nodes;
         std::unordered_map<const ngraph::Node*, size_t> node_dependency_count;
         std::unordered_map<ngraph::Node*, std::shared_ptr<ngraph::Node>> node_map;
+        node_dependency_count.reserve(nodes.size());
+        node_map.reserve(nodes.size());
 
-        for (auto node : nodes)
+        for (auto& node : nodes)
         {
             node_map[node.get()] = node;
-            node_dependency_count[node.get()] = node->get_arguments().size();
-            if (node->get_arguments().size() == 0)
+            size_t input_count = node->get_input_size();
+            node_dependency_count[node.get()] = input_count;
+            if (input_count == 0)
             {
                 independent_nodes.push_back(node.get());
             }
@@ -80,9 +83,7 @@ namespace ngraph
             for (auto user_sp : independent_node->get_users())
             {
                 Node* user = user_sp.get();
-                node_dependency_count[user] -= 1;
-                size_t count = node_dependency_count[user];
-                if (count == 0)
+                if (--node_dependency_count[user] == 0)
                 {
                     independent_nodes.push_back(user);
                 }
@@ -163,6 +164,18 @@ namespace ngraph
     // input function is cloned and returned
     std::shared_ptr<ngraph::Function> clone_function(const ngraph::Function& func);
 
+    // input function is cloned with batch_size as the extent of its batch axis (see
+    // Function::set_batch_axis); shape inference of the cloned ops carries the new extent to the
+    // results. Throws if an op fixes the extent, e.g. in the output shape of a Reshape.
+    std::shared_ptr<ngraph::Function> specialize_batch(const ngraph::Function& func,
+                                                       size_t batch_size);
+
+    // true if every slice along the batch axis of func's results depends only on the same slice
+    // of its batched parameters, so extra slices of the inputs do not change the others. Ops
+    // that combine slices, e.g. a Softmax or Reverse over the batch axis, and ops whose effect
+    // on the batch axis is not known make this false.
+    bool has_independent_batch_slices(const ngraph::Function& func);
+
     // Assert that nodes in the function is colocated and return that placement
     Placement get_colocated_function_placement(std::shared_ptr<Function> func);
 
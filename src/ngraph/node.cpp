@@ -89,12 +89,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Sh
     m_outputs.at(i).get_tensor_view()->set_tensor_view_type(element_type, shape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+StableVector<descriptor::Output, 1>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const StableVector<descriptor::Output, 1>& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -150,6 +150,16 @@ void Node::set_placement(Placement placement)
     m_placement = placement;
 }
 
+bool Node::is_fusable_rnn_cell() const
+{
+    return m_fusable_rnn_cell;
+}
+
+void Node::set_fusable_rnn_cell(bool fusable)
+{
+    m_fusable_rnn_cell = fusable;
+}
+
 std::shared_ptr<Node> Node::get_argument(size_t index) const
 {
     for (auto& i : get_inputs())
@@ -173,11 +183,11 @@ Node::~Node()
 NodeVector Node::get_arguments() const
 {
     NodeVector result;
-    for (auto& i : get_inputs())
+    result.reserve(m_inputs.size());
+    for (auto& i : m_inputs)
     {
-        {
-            result.push_back(i.get_output().get_node());
-        }
+        // The input already holds its argument; going through the output would lock a weak_ptr
+        result.push_back(i.m_src_node);
     }
     return result;
 }
@@ -254,7 +264,7 @@ shared_ptr<descriptor::TensorView> Node::get_output_tensor_view() const
     return get_output_tensor_view(0);
 }
 
-const std::set<descriptor::Input*>& Node::get_output_inputs(size_t i) const
+const descriptor::Output::Inputs& Node::get_output_inputs(size_t i) const
 {
     return m_outputs.at(i).get_inputs();
 }
@@ -332,6 +342,12 @@ descriptor::Output* Node::get_output_to(const shared_ptr<Node>& dst)
 NodeVector Node::get_users() const
 {
     NodeVector result;
+    size_t user_count = 0;
+    for (auto& output : m_outputs)
+    {
+        user_count += output.get_inputs().size();
+    }
+    result.reserve(user_count);
 
     for (size_t i = 0; i < get_output_size(); ++i)
     {
@@ -17,7 +17,6 @@
 #pragma once
 
 #include <atomic>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -34,6 +33,7 @@
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/node_vector.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/small_vector.hpp"
 
 namespace ngraph
 {
@@ -134,15 +134,15 @@ namespace ngraph
         friend std::ostream& operator<<(std::ostream&, const Node&);
 
         // TODO: Deprecate
-        std::deque<descriptor::Input>& get_inputs() { return m_inputs; }
+        StableVector<descriptor::Input, 2>& get_inputs() { return m_inputs; }
         // TODO: Deprecate
-        const std::deque<descriptor::Input>& get_inputs() const { return m_inputs; }
+        const StableVector<descriptor::Input, 2>& get_inputs() const { return m_inputs; }
         // Deprecated
         // TODO: Remove from unit tests.
-        std::deque<descriptor::Output>& get_outputs();
+        StableVector<descriptor::Output, 1>& get_outputs();
         // Deprecated
         // TODO: Remove from unit tests.
-        const std::deque<descriptor::Output>& get_outputs() const;
+        const StableVector<descriptor::Output, 1>& get_outputs() const;
 
         /// Returns the number of outputs on the for the node.
         size_t get_output_size() const;
@@ -172,7 +172,7 @@ namespace ngraph
         std::shared_ptr<descriptor::TensorView> get_output_tensor_view() const;
 
         /// Returns the set of inputs using output i
-        const std::set<descriptor::Input*>& get_output_inputs(size_t i) const;
+        const descriptor::Output::Inputs& get_output_inputs(size_t i) const;
 
         /// Returns the number of inputs for the op
         size_t get_input_size() const;
@@ -203,6 +203,13 @@ namespace ngraph
         /// Set device placement
         void set_placement(Placement placement);
 
+        /// True if a frontend built this node as the output of a recurrent cell, which
+        /// backends may replace with their fused RNN kernel
+        bool is_fusable_rnn_cell() const;
+
+        /// Mark this node as the output of a recurrent cell built by a frontend
+        void set_fusable_rnn_cell(bool fusable);
+
         /// Get input descriptor that is connected to src
         descriptor::Input* get_input_from(const std::shared_ptr<Node>& src);
 
@@ -223,10 +230,12 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        // Most nodes have one or two inputs and a single output, which are stored inline
+        StableVector<descriptor::Input, 2> m_inputs;
+        StableVector<descriptor::Output, 1> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
+        bool m_fusable_rnn_cell = false;
     };
 
     class NodeValidationError : public AssertionFailure
@@ -54,7 +54,7 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
+    if (m_data && !m_buffer)
     {
         aligned_free(m_data);
     }
@@ -152,6 +152,10 @@ vector<string> op::Constant::get_value_strings() const
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
+    if (m_buffer)
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_buffer);
+    }
     return make_shared<Constant>(m_element_type, m_shape, m_data);
 }
 
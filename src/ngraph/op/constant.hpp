@@ -19,6 +19,7 @@
 #include <cstring>
 #include <sstream>
 
+#include "ngraph/constant_store.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -60,6 +61,7 @@ namespace ngraph
                 {
                     write_values(values);
                 }
+                share_data();
                 constructor_validate_and_infer_types();
             }
 
@@ -83,6 +85,7 @@ namespace ngraph
 
                 std::vector<double> dvalues = parse_string<double>(values);
                 write_values(dvalues);
+                share_data();
                 constructor_validate_and_infer_types();
             }
 
@@ -96,11 +99,33 @@ namespace ngraph
                 : Node("Constant", {})
                 , m_element_type(type)
                 , m_shape(shape)
-                , m_data(nullptr)
+                , m_buffer(ConstantStore::get_default().intern(
+                      data, shape_size(m_shape) * m_element_type.size()))
             {
-                size_t size = shape_size(m_shape) * m_element_type.size();
-                m_data = ngraph::aligned_alloc(m_element_type.size(), size);
-                std::memcpy(m_data, data, size);
+                m_data = const_cast<void*>(m_buffer->get_ptr());
+                constructor_validate_and_infer_types();
+            }
+
+            /// \brief Constructs a tensor constant on data held by the constant store, e.g. a
+            ///        read-only mapping of a weights file.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param buffer The constant data, shared with the other constants using it.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<const ConstantStore::Buffer>& buffer)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(const_cast<void*>(buffer->get_ptr()))
+                , m_buffer(buffer)
+            {
+                NODE_VALIDATION_ASSERT(this,
+                                       buffer->size() >=
+                                           shape_size(m_shape) * m_element_type.size())
+                    << "Constant buffer of " << buffer->size()
+                    << " bytes is too small for a constant of shape " << m_shape;
                 constructor_validate_and_infer_types();
             }
 
@@ -165,6 +190,12 @@ namespace ngraph
             }
 
             const void* get_data_ptr() const { return m_data; }
+            /// \return The store buffer holding the constant's data, nullptr if the constant
+            ///         owns its data.
+            const std::shared_ptr<const ConstantStore::Buffer>& get_buffer() const
+            {
+                return m_buffer;
+            }
             template <typename T>
             const T* get_data_ptr() const
             {
@@ -180,6 +211,14 @@ namespace ngraph
             }
 
             virtual void infer_element_type() {}
+            // Replaces the freshly written data by the shared copy in the constant store
+            void share_data()
+            {
+                m_buffer = ConstantStore::get_default().adopt(
+                    m_data, shape_size(m_shape) * m_element_type.size());
+                m_data = const_cast<void*>(m_buffer->get_ptr());
+            }
+
             template <typename T>
             void write_values(const std::vector<T>& values)
             {
@@ -260,6 +299,7 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape{};
             void* m_data{nullptr};
+            std::shared_ptr<const ConstantStore::Buffer> m_buffer;
             Constant(const Constant&) = delete;
             Constant(Constant&&) = delete;
             Constant operator=(const Constant*) = delete;
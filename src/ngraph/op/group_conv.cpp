@@ -16,7 +16,7 @@
 
 #include <numeric>
 
-#include "group_conv.hpp"
+#include "ngraph/op/group_conv.hpp"
 
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -32,8 +32,7 @@ op::GroupConvolution::GroupConvolution(const shared_ptr<Node>& data_batch,
                                        const CoordinateDiff& padding_below,
                                        const CoordinateDiff& padding_above,
                                        const Strides& data_dilation_strides,
-                                       size_t groups,
-                                       const Shape& output_shape)
+                                       size_t groups)
     : Op("GroupConvolution", check_single_output_args({data_batch, filters}))
     , m_window_movement_strides(window_movement_strides)
     , m_window_dilation_strides(window_dilation_strides)
@@ -43,19 +42,58 @@ op::GroupConvolution::GroupConvolution(const shared_ptr<Node>& data_batch,
     , m_groups(groups)
 {
     constructor_validate_and_infer_types();
+}
 
-    auto& data_batch_et = data_batch->get_element_type();
-    auto& filters_et = filters->get_element_type();
+void op::GroupConvolution::validate_and_infer_types()
+{
+    auto& data_batch_shape = get_input_shape(0);
+    auto& data_batch_et = get_input_element_type(0);
+    auto& filters_shape = get_input_shape(1);
+    auto& filters_et = get_input_element_type(1);
 
-    //
-    // Make sure data batch and filter element types match.
-    //
-    if (data_batch_et != filters_et)
-    {
-        throw ngraph_error("Convolution data batch and filter element types do not match");
-    }
+    NODE_VALIDATION_ASSERT(this, data_batch_et == filters_et)
+        << "Element types for data batch and filters do not match (data batch element type: "
+        << data_batch_et << ", filters element type: " << filters_et << ").";
+
+    NODE_VALIDATION_ASSERT(this, data_batch_shape.size() >= 3)
+        << "Data batch input must have rank of at least 3 (data batch shape: "
+        << data_batch_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, filters_shape.size() == data_batch_shape.size())
+        << "Filters input must have the same rank as the data batch (filters shape: "
+        << filters_shape << ", data batch shape: " << data_batch_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, m_groups > 0) << "Number of groups must be positive.";
+
+    NODE_VALIDATION_ASSERT(this,
+                           data_batch_shape.at(1) % m_groups == 0 &&
+                               filters_shape.at(0) % m_groups == 0)
+        << "Input channel count and output channel count must both be divisible by the number "
+           "of groups (data batch shape: "
+        << data_batch_shape << ", filters shape: " << filters_shape << ", groups: " << m_groups
+        << ").";
+
+    // Each group convolves a C_IN / groups slice of the data with its own C_OUT / groups filters,
+    // so the shape follows from a plain convolution over one channel group.
+    Shape group_data_batch_shape{data_batch_shape};
+    group_data_batch_shape.at(1) /= m_groups;
 
-    set_output_type(0, data_batch_et, output_shape);
+    set_output_type(0,
+                    data_batch_et,
+                    util::infer_convolution_output_shape(this,
+                                                         group_data_batch_shape,
+                                                         filters_shape,
+                                                         m_window_movement_strides,
+                                                         m_window_dilation_strides,
+                                                         m_padding_below,
+                                                         m_padding_above,
+                                                         m_data_dilation_strides,
+                                                         0,
+                                                         1,
+                                                         1,
+                                                         0,
+                                                         0,
+                                                         1));
 }
 
 Shape op::GroupConvolution::get_weights_dimensions() const
@@ -88,8 +126,7 @@ shared_ptr<Node> op::GroupConvolution::copy_with_new_args(const NodeVector& new_
                                              get_padding_below(),
                                              get_padding_above(),
                                              get_data_dilation_strides(),
-                                             get_groups(),
-                                             this->get_shape());
+                                             get_groups());
 }
 
 void op::GroupConvolution::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
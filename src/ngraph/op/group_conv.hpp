@@ -23,10 +23,31 @@ namespace ngraph
 {
     namespace op
     {
-        /// \brief Group Convolution
+        /// \brief Batched convolution whose channels are split into independent groups.
         class GroupConvolution : public Op
         {
         public:
+            /// \brief Constructs a batched group convolution operation.
+            ///
+            /// \param data_batch The node producing the input data batch tensor.<br>
+            /// `[N, C_IN, D1, ... Df]`
+            /// \param filters The node producing the filters tensor.<br>
+            /// `[C_OUT, C_IN / groups, F1, ... Ff]`
+            /// \param window_movement_strides The window movement strides.<br>
+            /// `[f]`
+            /// \param window_dilation_strides The window dilation strides.<br>
+            /// `[f]`
+            /// \param padding_below The padding-below sizes.<br>
+            /// `[f]`
+            /// \param padding_above The padding-above sizes.<br>
+            /// `[f]`
+            /// \param data_dilation_strides The data dilation strides.<br>
+            /// `[f]`
+            /// \param groups The number of groups. Input channel group `g` is convolved with
+            /// the `g`-th block of `C_OUT / groups` filters only.
+            ///
+            /// Output `[N, C_OUT, R1, ... Rf]`
+            ///
             GroupConvolution(const std::shared_ptr<Node>& data_batch,
                              const std::shared_ptr<Node>& filters,
                              const Strides& window_movement_strides,
@@ -34,8 +55,9 @@ namespace ngraph
                              const CoordinateDiff& padding_below,
                              const CoordinateDiff& padding_above,
                              const Strides& data_dilation_strides,
-                             size_t groups,
-                             const Shape& output_shape);
+                             size_t groups);
+
+            void validate_and_infer_types() override;
 
             Shape get_weights_dimensions() const;
             const Strides& get_window_movement_strides() const { return m_window_movement_strides; }
@@ -66,6 +66,7 @@ NGRAPH_OP(FunctionCall)
 NGRAPH_OP(GetOutputElement)
 NGRAPH_OP(Greater)
 NGRAPH_OP(GreaterEq)
+NGRAPH_OP(GroupConvolution)
 NGRAPH_OP(Less)
 NGRAPH_OP(LessEq)
 NGRAPH_OP(Log)
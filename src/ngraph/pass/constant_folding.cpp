@@ -38,13 +38,13 @@ shared_ptr<op::Constant> make_constant_reshape(shared_ptr<op::Constant> constant
     auto out_shape = reshape->get_shape();
     vector<T> out_vec(shape_size(out_shape));
 
-    runtime::reference::reshape<T>(constant->get_vector<T>().data(),
+    runtime::reference::reshape<T>(constant->get_data_ptr<T>(),
                                    out_vec.data(),
                                    constant->get_shape(),
                                    reshape->get_input_order(),
                                    out_shape);
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec.data());
 }
 
 template <class T>
@@ -55,8 +55,8 @@ shared_ptr<op::Constant> make_constant_pad(shared_ptr<op::Constant> constant,
     vector<T> out_vec(shape_size(out_shape));
     auto pad_value = std::dynamic_pointer_cast<op::Constant>(pad->get_argument(1));
 
-    runtime::reference::pad<T>(constant->get_vector<T>().data(),
-                               pad_value->get_vector<T>().data(),
+    runtime::reference::pad<T>(constant->get_data_ptr<T>(),
+                               pad_value->get_data_ptr<T>(),
                                out_vec.data(),
                                constant->get_shape(),
                                out_shape,
@@ -64,7 +64,7 @@ shared_ptr<op::Constant> make_constant_pad(shared_ptr<op::Constant> constant,
                                pad->get_padding_above(),
                                pad->get_padding_interior());
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec.data());
 }
 
 void ngraph::pass::ConstantFolding::construct_constant_pad()
@@ -174,13 +174,13 @@ shared_ptr<op::Constant> make_constant_broadcast(shared_ptr<op::Constant> consta
     auto out_shape = broadcast->get_shape();
     vector<T> out_vec(shape_size(out_shape));
 
-    runtime::reference::broadcast<T>(constant->get_vector<T>().data(),
+    runtime::reference::broadcast<T>(constant->get_data_ptr<T>(),
                                      out_vec.data(),
                                      constant->get_shape(),
                                      out_shape,
                                      broadcast->get_broadcast_axes());
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec.data());
 }
 
 void ngraph::pass::ConstantFolding::construct_constant_broadcast()
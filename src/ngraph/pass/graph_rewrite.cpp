@@ -16,21 +16,95 @@
 
 #include <algorithm>
 #include <iostream>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+
+// Buckets matchers by the type of their pattern's root. A root that is not a pattern op only
+// matches graph nodes of exactly the same type (see Matcher::match_node), so a node is only
+// offered the matchers of its own type plus those rooted at a Label, Skip or Any. Each bucket
+// keeps the registration order, which decides which of several matching rewrites wins.
+template <typename M>
+class MatcherIndex
+{
+public:
+    MatcherIndex(const std::vector<std::shared_ptr<M>>& matchers)
+    {
+        std::unordered_map<std::type_index, std::vector<size_t>> typed;
+        std::vector<size_t> untyped;
+        for (size_t i = 0; i < matchers.size(); i++)
+        {
+            auto root = matchers[i]->get_pattern();
+            if (std::dynamic_pointer_cast<ngraph::pattern::op::Pattern>(root))
+            {
+                untyped.push_back(i);
+            }
+            else
+            {
+                typed[std::type_index(typeid(*root))].push_back(i);
+            }
+        }
+
+        for (auto i : untyped)
+        {
+            m_untyped.push_back(matchers[i]);
+        }
+        for (auto& bucket : typed)
+        {
+            std::vector<size_t> indices;
+            std::merge(bucket.second.begin(),
+                       bucket.second.end(),
+                       untyped.begin(),
+                       untyped.end(),
+                       std::back_inserter(indices));
+            auto& bucket_matchers = m_typed[bucket.first];
+            for (auto i : indices)
+            {
+                bucket_matchers.push_back(matchers[i]);
+            }
+        }
+    }
+
+    const std::vector<std::shared_ptr<M>>& get_matchers(const ngraph::Node& node) const
+    {
+        auto it = m_typed.find(std::type_index(typeid(node)));
+        return it == m_typed.end() ? m_untyped : it->second;
+    }
+
+private:
+    std::unordered_map<std::type_index, std::vector<std::shared_ptr<M>>> m_typed;
+    std::vector<std::shared_ptr<M>> m_untyped;
+};
+
+// Most matchers are not given a name, so those are told apart by the op at their root
+template <typename M>
+static std::string profile_name(M& matcher)
+{
+    auto name = matcher.get_name();
+    if (name == "Unnamed")
+    {
+        name += "(" + matcher.get_pattern()->description() + ")";
+    }
+    return name;
+}
 
 bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     const std::list<std::shared_ptr<ngraph::Node>>& nodes,
     const std::vector<std::shared_ptr<pattern::Matcher>>& matchers,
-    std::shared_ptr<ngraph::Function> f)
+    std::shared_ptr<ngraph::Function> f,
+    std::map<std::string, size_t>* matchers_fired)
 {
     bool rewritten = false;
+    MatcherIndex<pattern::Matcher> index(matchers);
     for (auto node : nodes)
     {
-        for (auto matcher : matchers)
+        for (auto& matcher : index.get_matchers(*node))
         {
             NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                          << matcher->get_pattern()->get_name() << ") on " << node->get_name();
@@ -41,6 +115,10 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
                 rewritten = true;
                 if (matcher->process_match())
                 {
+                    if (matchers_fired)
+                    {
+                        (*matchers_fired)[profile_name(*matcher)]++;
+                    }
                     break;
                 }
             }
@@ -51,18 +129,94 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
 
 bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    return run_matchers_on_nodes_list(f->get_ordered_ops(), m_matchers, f);
+    return run_matchers_on_nodes_list(f->get_ordered_ops(), m_matchers, f, &m_matchers_fired);
+}
+
+// After a rewrite, only nodes the rewrite could have affected need another attempt: the nodes it
+// created, their neighbours, the arguments of the nodes it removed, and everything downstream of
+// the new nodes and of the current users of those arguments, since a match looks at a node's
+// arguments. The latter catches the former users of a node replaced by one of its (transitive)
+// arguments. Nodes the previous sweep did not reach yet stay on the worklist.
+static std::unordered_set<ngraph::Node*>
+    touched_nodes(const std::list<std::shared_ptr<ngraph::Node>>& old_ops,
+                  const std::list<std::shared_ptr<ngraph::Node>>& new_ops)
+{
+    std::unordered_set<ngraph::Node*> old_nodes;
+    for (auto& node : old_ops)
+    {
+        old_nodes.insert(node.get());
+    }
+    std::unordered_set<ngraph::Node*> new_nodes;
+    for (auto& node : new_ops)
+    {
+        new_nodes.insert(node.get());
+    }
+
+    std::unordered_set<ngraph::Node*> touched;
+    std::vector<ngraph::Node*> downstream;
+    for (auto& node : new_ops)
+    {
+        if (old_nodes.count(node.get()) == 0)
+        {
+            downstream.push_back(node.get());
+            for (auto& arg : node->get_arguments())
+            {
+                touched.insert(arg.get());
+            }
+        }
+    }
+    for (auto& node : old_ops)
+    {
+        if (new_nodes.count(node.get()) == 0)
+        {
+            for (auto& arg : node->get_arguments())
+            {
+                touched.insert(arg.get());
+                for (auto& user : arg->get_users())
+                {
+                    downstream.push_back(user.get());
+                }
+            }
+        }
+    }
+    while (!downstream.empty())
+    {
+        auto node = downstream.back();
+        downstream.pop_back();
+        if (touched.insert(node).second)
+        {
+            for (auto& user : node->get_users())
+            {
+                downstream.push_back(user.get());
+            }
+        }
+    }
+    return touched;
 }
 
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool changed = false;
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
+    // the first sweep looks at every node, later ones only at the worklist
+    bool full_sweep = true;
+    std::unordered_set<Node*> worklist;
+    bool rewritten = false;
     size_t i = 0;
     do
     {
-        for (auto node : f->get_ops())
+        rewritten = false;
+        std::unordered_set<Node*> unvisited;
+        // keeps the nodes of this sweep alive so that touched_nodes can tell them apart
+        auto ops = f->get_ops();
+        for (auto it = ops.begin(); it != ops.end(); it++)
         {
-            for (auto matcher : m_matchers)
+            auto& node = *it;
+            if (!full_sweep && worklist.count(node.get()) == 0)
+            {
+                continue;
+            }
+            for (auto& matcher : index.get_matchers(*node))
             {
                 NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
                 if (matcher->match(node))
@@ -70,14 +224,33 @@ bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph
                     NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
                     if (matcher->process_match())
                     {
-                        changed = true;
-                        goto next_fusion;
+                        m_matchers_fired[profile_name(*matcher)]++;
+                        rewritten = true;
+                        break;
                     }
                 }
             }
+            if (rewritten)
+            {
+                for (it++; it != ops.end(); it++)
+                {
+                    if (full_sweep || worklist.count(it->get()) != 0)
+                    {
+                        unvisited.insert(it->get());
+                    }
+                }
+                break;
+            }
+        }
+
+        if (rewritten)
+        {
+            worklist = touched_nodes(ops, f->get_ops());
+            worklist.insert(unvisited.begin(), unvisited.end());
+            full_sweep = false;
         }
-    next_fusion:
+        changed = changed || rewritten;
         i++;
-    } while (changed && i < m_num_iters);
+    } while (rewritten && i < m_num_iters);
     return changed;
 }
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <set>
 #include "ngraph/pass/pass.hpp"
 
@@ -53,16 +54,20 @@ public:
     }
 
     void add_matcher(std::shared_ptr<pattern::Matcher> m) { m_matchers.push_back(m); }
+    /// \param matchers_fired if given, counts the rewrites performed per matcher name
     static bool
         run_matchers_on_nodes_list(const std::list<std::shared_ptr<ngraph::Node>>& nodes,
                                    const std::vector<std::shared_ptr<pattern::Matcher>>& matchers,
-                                   std::shared_ptr<ngraph::Function> f);
+                                   std::shared_ptr<ngraph::Function> f,
+                                   std::map<std::string, size_t>* matchers_fired = nullptr);
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
-
+    /// \return the rewrites performed per matcher name over all runs of this pass
+    const std::map<std::string, size_t>& get_matchers_fired() const { return m_matchers_fired; }
 private:
     // enable cascading rewrites
     std::vector<std::shared_ptr<pattern::Matcher>> m_matchers;
+    std::map<std::string, size_t> m_matchers_fired;
 };
 
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
@@ -76,8 +81,10 @@ public:
 
     void add_matcher(std::shared_ptr<pattern::RecurrentMatcher> m) { m_matchers.push_back(m); }
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
-
+    /// \return the rewrites performed per matcher name over all runs of this pass
+    const std::map<std::string, size_t>& get_matchers_fired() const { return m_matchers_fired; }
 private:
     size_t m_num_iters;
     std::vector<std::shared_ptr<pattern::RecurrentMatcher>> m_matchers;
+    std::map<std::string, size_t> m_matchers_fired;
 };
@@ -19,24 +19,120 @@
 #else
 #include <cxxabi.h>
 #endif
+#include <atomic>
+#include <cstdlib>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/function_call.hpp"
 #include "ngraph/op/reduce.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+static atomic<bool> s_global_profiling{false};
+static mutex s_global_profile_mutex;
+// Oldest records are dropped beyond s_global_profile_limit so that a long running process
+// that never takes the profile does not grow without bound
+static deque<pass::PassProfile> s_global_profile;
+static const size_t s_global_profile_limit = 65536;
+
+static string get_pass_name(pass::PassBase* pass)
+{
+    string name = typeid(*pass).name();
+#ifndef WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), 0, 0, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+// Bytes the heap currently hands out, 0 where the allocator offers no way to ask. Older glibc
+// only has mallinfo(), whose int fields wrap once the heap passes 2 GB, so it is not used.
+static int64_t get_heap_bytes_in_use()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return static_cast<int64_t>(info.uordblks + info.hblkhd);
+#else
+    return 0;
+#endif
+}
+
+static size_t count_nodes(const vector<shared_ptr<Function>>& fs)
+{
+    size_t count = 0;
+    for (auto& f : fs)
+    {
+        count += f->get_ops().size();
+    }
+    return count;
+}
+
+static map<string, size_t> get_matchers_fired(pass::PassBase* pass)
+{
+    if (auto graph_rewrite = dynamic_cast<pass::GraphRewrite*>(pass))
+    {
+        return graph_rewrite->get_matchers_fired();
+    }
+    if (auto recurrent_graph_rewrite = dynamic_cast<pass::RecurrentGraphRewrite*>(pass))
+    {
+        return recurrent_graph_rewrite->get_matchers_fired();
+    }
+    return {};
+}
+
+string ngraph::pass::pass_profile_to_json(const vector<PassProfile>& profile)
+{
+    nlohmann::json passes = nlohmann::json::array();
+    for (const PassProfile& record : profile)
+    {
+        nlohmann::json pass;
+        pass["name"] = record.name;
+        pass["time_us"] = record.time_us;
+        pass["nodes_before"] = record.nodes_before;
+        pass["nodes_after"] = record.nodes_after;
+        pass["allocated_bytes"] = record.allocated_bytes;
+        pass["matchers_fired"] = record.matchers_fired;
+        passes.push_back(pass);
+    }
+    return passes.dump(4);
+}
+
+void ngraph::pass::Manager::set_global_pass_profiling(bool new_state)
+{
+    s_global_profiling = new_state;
+}
+
+vector<pass::PassProfile> ngraph::pass::Manager::take_global_pass_profile()
+{
+    lock_guard<mutex> lock(s_global_profile_mutex);
+    vector<PassProfile> profile(s_global_profile.begin(), s_global_profile.end());
+    s_global_profile.clear();
+    return profile;
+}
+
 ngraph::pass::Manager::Manager()
 {
     static const auto nevt = std::getenv("NGRAPH_ENABLE_VISUALIZE_TRACING");
@@ -62,6 +158,8 @@ void ngraph::pass::Manager::initialize_default_passes()
 void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
 {
     bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    bool global_profiling = s_global_profiling;
+    bool collect_profile = m_profile || global_profiling;
 
     vector<shared_ptr<Function>> fs;
     if (transitive)
@@ -82,6 +180,15 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile record;
+        map<string, size_t> matchers_fired;
+        if (collect_profile)
+        {
+            record.name = get_pass_name(pass.get());
+            record.nodes_before = count_nodes(fs);
+            record.allocated_bytes = -get_heap_bytes_in_use();
+            matchers_fired = get_matchers_fired(pass.get());
+        }
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -147,15 +254,38 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
         }
         index++;
         pass_timer.stop();
+        if (collect_profile)
+        {
+            record.time_us = pass_timer.get_microseconds();
+            record.allocated_bytes += get_heap_bytes_in_use();
+            record.nodes_after = count_nodes(fs);
+            // the counters of a rewrite pass accumulate over runs, keep what this run added
+            for (auto& fired : get_matchers_fired(pass.get()))
+            {
+                size_t count = fired.second - matchers_fired[fired.first];
+                if (count > 0)
+                {
+                    record.matchers_fired[fired.first] = count;
+                }
+            }
+            if (global_profiling)
+            {
+                lock_guard<mutex> lock(s_global_profile_mutex);
+                if (s_global_profile.size() == s_global_profile_limit)
+                {
+                    s_global_profile.pop_front();
+                }
+                s_global_profile.push_back(record);
+            }
+            if (m_profile)
+            {
+                m_pass_profile.push_back(record);
+            }
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), 0, 0, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << get_pass_name(pass.get())
+                 << "\n";
         }
     }
     if (profile_enabled)
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -30,6 +33,23 @@ namespace ngraph
     {
         class Manager;
         class ManagerState;
+
+        /// \brief What a single pass did to the graph during Manager::run_passes
+        struct PassProfile
+        {
+            std::string name;
+            /// Wall time of the pass, including the revalidation that follows it
+            size_t time_us = 0;
+            size_t nodes_before = 0;
+            size_t nodes_after = 0;
+            /// Growth of the heap in use over the pass; 0 where the allocator can't tell
+            int64_t allocated_bytes = 0;
+            /// Rewrites performed per matcher name, for GraphRewrite passes
+            std::map<std::string, size_t> matchers_fired;
+        };
+
+        /// \brief Renders profile records as a JSON array, one object per pass
+        std::string pass_profile_to_json(const std::vector<PassProfile>& profile);
     }
 }
 
@@ -59,10 +79,22 @@ public:
     ManagerState& get_state();
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Records a PassProfile for every pass this manager runs
+    void set_pass_profiling(bool new_state) { m_profile = new_state; }
+    const std::vector<PassProfile>& get_pass_profile() const { return m_pass_profile; }
+    /// \brief Records the passes of every Manager in the process, including the ones backends
+    ///        run while compiling. Only the latest 65536 records are kept, so take them
+    ///        regularly in long running processes.
+    static void set_global_pass_profiling(bool new_state);
+    /// \return the records collected by global profiling so far, which are then cleared
+    static std::vector<PassProfile> take_global_pass_profile();
+
 private:
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
+    std::vector<PassProfile> m_pass_profile;
     ManagerState m_state;
     bool m_visualize = false;
     bool m_serialize = false;
+    bool m_profile = false;
 };
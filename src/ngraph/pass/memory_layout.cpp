@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
@@ -27,16 +30,52 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool offline_planning)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_offline_planning(offline_planning)
+    , m_pool_size(0)
+    , m_lower_bound(0)
 {
 }
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+
+    // The planner tracks every tensor's lifetime in steps of the op schedule. It places the
+    // tensors when offline planning and otherwise computes the lower bound of the report.
+    MemoryPlanner planner(m_alignment);
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    unordered_map<const descriptor::Tensor*, size_t> last_use;
+    size_t tensor_count = 0;
+    size_t step = 0;
+    for (shared_ptr<Node> node : ops)
+    {
+        for (const descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            last_use[tensor] = step;
+        }
+        tensor_count += node->liveness_new_list.size();
+        step++;
+    }
+    bool offline_planning = m_offline_planning && tensor_count <= s_max_planned_tensors;
+    if (m_offline_planning && !offline_planning)
+    {
+        NGRAPH_DEBUG << "Laying out the " << tensor_count << " tensors of "
+                     << function->get_name() << " first-fit";
+    }
+    auto get_last_use = [&](const descriptor::Tensor* tensor) {
+        auto it = last_use.find(tensor);
+        return (m_disable_memory_sharing || it == last_use.end() ? ops.size() : it->second);
+    };
+    vector<pair<descriptor::Tensor*, size_t>> tensor_buffers;
+    unordered_map<const descriptor::Tensor*, size_t> buffers;
+
+    step = 0;
+    for (shared_ptr<Node> node : ops)
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
         std::set<const descriptor::Tensor*> reused_inputs;
@@ -67,14 +106,30 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
+            size_t buffer;
+            if (in_place_outputs.count(tensor) && buffers.count(in_place_outputs.at(tensor)))
+            {
+                buffer = buffers.at(in_place_outputs.at(tensor));
+                planner.extend_buffer(buffer, tensor->size(), get_last_use(tensor));
+            }
+            else
+            {
+                buffer = planner.add_buffer(tensor->size(), step, get_last_use(tensor));
+            }
+            buffers[tensor] = buffer;
+            tensor_buffers.push_back({tensor, buffer});
+
+            if (!offline_planning)
+            {
+                size_t offset = in_place_outputs.count(tensor)
+                                    ? in_place_outputs.at(tensor)->get_pool_offset()
+                                    : mm.allocate(tensor->size());
 
-            tensor->set_pool_offset(offset);
+                tensor->set_pool_offset(offset);
+            }
         }
 
-        if (!m_disable_memory_sharing)
+        if (!m_disable_memory_sharing && !offline_planning)
         {
             for (const descriptor::Tensor* tensor : node->liveness_free_list)
             {
@@ -84,8 +139,25 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
                 }
             }
         }
+        step++;
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+
+    if (offline_planning)
+    {
+        m_pool_size = planner.plan();
+        for (auto& tensor_buffer : tensor_buffers)
+        {
+            tensor_buffer.first->set_pool_offset(planner.get_offset(tensor_buffer.second));
+        }
+    }
+    else
+    {
+        m_pool_size = mm.max_allocated();
+    }
+    m_lower_bound = planner.lower_bound();
+    function->set_temporary_pool_size(m_pool_size);
+    NGRAPH_DEBUG << "Temporary pool of " << function->get_name() << ": " << m_pool_size
+                 << " bytes, lower bound " << m_lower_bound << " bytes";
 
     return false;
 }
@@ -268,3 +340,93 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::MemoryPlanner::MemoryPlanner(size_t alignment)
+    : m_alignment{alignment}
+    , m_max_allocated{0}
+{
+}
+
+size_t pass::MemoryPlanner::add_buffer(size_t size, size_t first_use, size_t last_use)
+{
+    m_buffers.push_back(
+        {MemoryManager::align(size, m_alignment), first_use, max(first_use, last_use), 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPlanner::extend_buffer(size_t index, size_t size, size_t last_use)
+{
+    buffer& b = m_buffers.at(index);
+    b.m_size = max(b.m_size, MemoryManager::align(size, m_alignment));
+    b.m_last_use = max(b.m_last_use, last_use);
+}
+
+size_t pass::MemoryPlanner::plan()
+{
+    vector<size_t> order(m_buffers.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+
+    m_max_allocated = 0;
+    vector<const buffer*> placed;
+    for (size_t index : order)
+    {
+        buffer& b = m_buffers[index];
+
+        // Memory of the placed buffers that are live at the same time, by offset
+        vector<pair<size_t, size_t>> taken;
+        for (const buffer* other : placed)
+        {
+            if (other->m_first_use <= b.m_last_use && b.m_first_use <= other->m_last_use)
+            {
+                taken.push_back({other->m_offset, other->m_offset + other->m_size});
+            }
+        }
+        sort(taken.begin(), taken.end());
+
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t gap_start = 0;
+        for (const auto& extent : taken)
+        {
+            if (extent.first > gap_start)
+            {
+                size_t gap = extent.first - gap_start;
+                if (gap >= b.m_size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = gap_start;
+                }
+            }
+            gap_start = max(gap_start, extent.second);
+        }
+        b.m_offset = (best_offset != numeric_limits<size_t>::max() ? best_offset : gap_start);
+        m_max_allocated = max(m_max_allocated, b.m_offset + b.m_size);
+        placed.push_back(&b);
+    }
+    return m_max_allocated;
+}
+
+size_t pass::MemoryPlanner::lower_bound() const
+{
+    // Size allocated and released at each step
+    map<size_t, pair<size_t, size_t>> changes;
+    for (const buffer& b : m_buffers)
+    {
+        changes[b.m_first_use].first += b.m_size;
+        changes[b.m_last_use + 1].second += b.m_size;
+    }
+    size_t live = 0;
+    size_t peak = 0;
+    for (const auto& change : changes)
+    {
+        live = live + change.second.first - change.second.second;
+        peak = max(peak, live);
+    }
+    return peak;
+}
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +30,37 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPlanner;
     }
 }
 
+/// \brief Assigns each intermediate tensor an offset in the function's temporary pool.
+///
+/// By default tensors are allocated first-fit in execution order. With offline_planning
+/// the whole schedule is laid out at once by MemoryPlanner, which usually needs a smaller
+/// pool. Functions with more than s_max_planned_tensors tensors are still laid out first-fit,
+/// since the planner compares each tensor with all tensors placed before it.
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    static const size_t s_max_planned_tensors = 4096;
+
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool offline_planning = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    /// \brief Temporary pool size of the last function laid out
+    size_t get_pool_size() const { return m_pool_size; }
+    /// \brief Smallest pool any layout of the last function could use, the largest total
+    ///     size of the tensors live at one time
+    size_t get_lower_bound() const { return m_lower_bound; }
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_offline_planning;
+    size_t m_pool_size;
+    size_t m_lower_bound;
 };
 
 class ngraph::pass::MemoryManager
@@ -95,3 +115,42 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Offline memory planner that sees the lifetimes of all buffers before placing any.
+///
+/// Buffers are placed greedily in decreasing size, each in the smallest gap between the
+/// already placed buffers whose lifetimes intersect its own, or above all of them.
+class ngraph::pass::MemoryPlanner
+{
+public:
+    MemoryPlanner(size_t alignment = 1);
+
+    /// \brief Adds a buffer used from step first_use through step last_use
+    /// \return Index of the buffer
+    size_t add_buffer(size_t size, size_t first_use, size_t last_use);
+    /// \brief Grows a buffer for a tensor that shares its memory
+    void extend_buffer(size_t buffer, size_t size, size_t last_use);
+
+    /// \brief Assigns the offsets of all buffers
+    /// \return Size of the pool
+    size_t plan();
+    size_t get_offset(size_t buffer) const { return m_buffers.at(buffer).m_offset; }
+    size_t max_allocated() const { return m_max_allocated; }
+    /// \brief Largest total size of the buffers live at any step. No placement of the
+    ///     buffers fits in less memory.
+    size_t lower_bound() const;
+
+private:
+    class buffer
+    {
+    public:
+        size_t m_size;
+        size_t m_first_use;
+        size_t m_last_use;
+        size_t m_offset;
+    };
+
+    std::vector<buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_max_allocated;
+};
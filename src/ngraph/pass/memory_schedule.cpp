@@ -0,0 +1,258 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/descriptor/input.hpp"
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Tracks the intermediate tensors live while ops are run one at a time. Tensors of
+    // parameters, constants and results are not allocated in the temporary pool and not
+    // counted.
+    class LiveTensors
+    {
+    public:
+        LiveTensors(const list<shared_ptr<Node>>& ops)
+            : m_live_bytes(0)
+        {
+            for (const shared_ptr<Node>& node : ops)
+            {
+                bool persistent = node->is_parameter() || node->is_constant() ||
+                                  dynamic_pointer_cast<op::Result>(node) != nullptr;
+                for (size_t i = 0; i < node->get_output_size(); ++i)
+                {
+                    m_tensors[&node->get_output_tensor(i)].m_persistent = persistent;
+                }
+            }
+            for (const shared_ptr<Node>& node : ops)
+            {
+                for (const descriptor::Input& input : node->get_inputs())
+                {
+                    m_tensors[&input.get_tensor()].m_remaining_uses++;
+                }
+            }
+        }
+
+        // Change of the live bytes once node has run, outputs nobody reads excepted
+        int64_t get_delta(const Node* node) const
+        {
+            int64_t delta = 0;
+            for (size_t i = 0; i < node->get_output_size(); ++i)
+            {
+                const descriptor::Tensor* tensor = &node->get_output_tensor(i);
+                const TensorState& state = m_tensors.at(tensor);
+                if (!state.m_persistent && state.m_remaining_uses > 0)
+                {
+                    delta += tensor->size();
+                }
+            }
+            for (auto& read : count_reads(node))
+            {
+                const TensorState& state = m_tensors.at(read.first);
+                if (!state.m_persistent && state.m_remaining_uses == read.second)
+                {
+                    delta -= read.first->size();
+                }
+            }
+            return delta;
+        }
+
+        // Runs node and returns the live bytes while it runs
+        size_t run(const Node* node)
+        {
+            for (size_t i = 0; i < node->get_output_size(); ++i)
+            {
+                const descriptor::Tensor* tensor = &node->get_output_tensor(i);
+                if (!m_tensors.at(tensor).m_persistent)
+                {
+                    m_live_bytes += tensor->size();
+                }
+            }
+            size_t peak = m_live_bytes;
+            for (auto& read : count_reads(node))
+            {
+                TensorState& state = m_tensors.at(read.first);
+                state.m_remaining_uses -= read.second;
+                if (!state.m_persistent && state.m_remaining_uses == 0)
+                {
+                    m_live_bytes -= read.first->size();
+                }
+            }
+            for (size_t i = 0; i < node->get_output_size(); ++i)
+            {
+                const descriptor::Tensor* tensor = &node->get_output_tensor(i);
+                const TensorState& state = m_tensors.at(tensor);
+                if (!state.m_persistent && state.m_remaining_uses == 0)
+                {
+                    m_live_bytes -= tensor->size();
+                }
+            }
+            return peak;
+        }
+
+        size_t get_live_bytes() const { return m_live_bytes; }
+    private:
+        struct TensorState
+        {
+            bool m_persistent = false;
+            size_t m_remaining_uses = 0;
+        };
+
+        static unordered_map<const descriptor::Tensor*, size_t> count_reads(const Node* node)
+        {
+            unordered_map<const descriptor::Tensor*, size_t> reads;
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                reads[&input.get_tensor()]++;
+            }
+            return reads;
+        }
+
+        unordered_map<const descriptor::Tensor*, TensorState> m_tensors;
+        size_t m_live_bytes;
+    };
+}
+
+pass::MemorySchedule::MemorySchedule(const string& dump_file)
+    : m_dump_file(dump_file)
+    , m_original_peak(0)
+    , m_peak(0)
+{
+}
+
+size_t pass::MemorySchedule::get_peak(const list<shared_ptr<Node>>& ordered_ops)
+{
+    LiveTensors live(ordered_ops);
+    size_t peak = 0;
+    for (const shared_ptr<Node>& node : ordered_ops)
+    {
+        peak = max(peak, live.run(node.get()));
+    }
+    return peak;
+}
+
+bool pass::MemorySchedule::run_on_function(shared_ptr<Function> function)
+{
+    list<shared_ptr<Node>> original_order = function->get_ordered_ops();
+    m_original_peak = get_peak(original_order);
+
+    // Ties keep the original order
+    unordered_map<Node*, size_t> positions;
+    unordered_map<Node*, size_t> pending_arguments;
+    unordered_map<Node*, vector<Node*>> users;
+    for (const shared_ptr<Node>& node : original_order)
+    {
+        size_t position = positions.size();
+        positions[node.get()] = position;
+        unordered_set<Node*> arguments;
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            arguments.insert(input.get_output().get_node().get());
+        }
+        pending_arguments[node.get()] = arguments.size();
+        for (Node* argument : arguments)
+        {
+            users[argument].push_back(node.get());
+        }
+    }
+
+    vector<Node*> ready;
+    for (const shared_ptr<Node>& node : original_order)
+    {
+        if (pending_arguments[node.get()] == 0)
+        {
+            ready.push_back(node.get());
+        }
+    }
+
+    LiveTensors live(original_order);
+    list<shared_ptr<Node>> order;
+    size_t peak = 0;
+    while (!ready.empty())
+    {
+        size_t best = 0;
+        int64_t best_delta = live.get_delta(ready[0]);
+        for (size_t i = 1; i < ready.size(); i++)
+        {
+            int64_t delta = live.get_delta(ready[i]);
+            if (delta < best_delta ||
+                (delta == best_delta && positions[ready[i]] < positions[ready[best]]))
+            {
+                best = i;
+                best_delta = delta;
+            }
+        }
+        Node* node = ready[best];
+        ready[best] = ready.back();
+        ready.pop_back();
+
+        order.push_back(node->shared_from_this());
+        peak = max(peak, live.run(node));
+        for (Node* user : users[node])
+        {
+            if (--pending_arguments[user] == 0)
+            {
+                ready.push_back(user);
+            }
+        }
+    }
+    if (order.size() != original_order.size())
+    {
+        throw ngraph_error("MemorySchedule: function graph has a cycle");
+    }
+
+    if (peak < m_original_peak)
+    {
+        function->set_ordered_ops(order);
+        m_peak = peak;
+    }
+    else
+    {
+        order = original_order;
+        m_peak = m_original_peak;
+    }
+    NGRAPH_DEBUG << "MemorySchedule " << function->get_name() << ": peak " << m_peak
+                 << " bytes, " << m_original_peak << " bytes in topological order";
+
+    if (!m_dump_file.empty())
+    {
+        ofstream out{m_dump_file, ios_base::app};
+        out << function->get_name() << " peak " << m_peak << " bytes, topological order "
+            << m_original_peak << " bytes\n";
+        LiveTensors dump_live(order);
+        for (const shared_ptr<Node>& node : order)
+        {
+            dump_live.run(node.get());
+            out << "    " << node->get_name() << " " << dump_live.get_live_bytes() << "\n";
+        }
+    }
+
+    return false;
+}
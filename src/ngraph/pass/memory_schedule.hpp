@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemorySchedule;
+    }
+}
+
+/// \brief Chooses a topological order of the function's ops that keeps the memory of live
+///     intermediate tensors low and makes get_ordered_ops() return it.
+///
+/// Ops are scheduled greedily. Among the ops whose arguments are computed, the one that
+/// frees the most memory net of the tensors it allocates runs first. Run the pass after
+/// the last graph rewrite and before Liveness.
+class ngraph::pass::MemorySchedule : public FunctionPass
+{
+public:
+    /// \param dump_file If not empty, the chosen order and the bytes live after each op are
+    ///     written to this file
+    MemorySchedule(const std::string& dump_file = "");
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// \brief Peak bytes of live intermediates in the last function's original order
+    size_t get_original_peak() const { return m_original_peak; }
+    /// \brief Peak bytes of live intermediates in the last function's chosen order
+    size_t get_peak() const { return m_peak; }
+    /// \brief Peak bytes of live intermediates when running ops in the given order
+    static size_t get_peak(const std::list<std::shared_ptr<Node>>& ordered_ops);
+
+private:
+    const std::string m_dump_file;
+    size_t m_original_peak;
+    size_t m_peak;
+};
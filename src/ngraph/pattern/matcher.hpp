@@ -182,11 +182,13 @@ namespace ngraph
             RecurrentMatcher(std::shared_ptr<Node> pattern,
                              std::shared_ptr<op::Label> rpattern,
                              const std::set<std::shared_ptr<op::Label>>& correlated_patterns,
-                             recurrent_graph_rewrite_callback callback)
+                             recurrent_graph_rewrite_callback callback,
+                             const std::string& name = "Unnamed")
                 : m_pattern(pattern)
                 , m_recurrent_pattern(rpattern)
                 , m_correlated_patterns(correlated_patterns)
                 , m_callback(callback)
+                , m_name(name)
             {
             }
 
@@ -213,6 +215,8 @@ namespace ngraph
             }
 
             size_t get_number_of_bound_labels() const { return m_matches.size(); }
+            std::shared_ptr<Node> get_pattern() { return m_pattern; }
+            std::string get_name() { return m_name; }
             /// \brief Tries to match a pattern for an individual cell to a given \p graph
             bool match(std::shared_ptr<Node> graph);
 
@@ -227,6 +231,7 @@ namespace ngraph
             RPatternMap m_matches;
             recurrent_graph_rewrite_callback m_callback;
             std::shared_ptr<Node> m_match_root;
+            std::string m_name;
         };
     }
 }
@@ -14,7 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
@@ -25,6 +30,90 @@
 using namespace std;
 using namespace ngraph;
 
+// Runs the tasks of call_async in submission order on a lazily started worker thread and
+// tracks the calls that have not completed yet.
+class runtime::Backend::AsyncExecutor
+{
+public:
+    ~AsyncExecutor()
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        if (m_worker.joinable())
+        {
+            m_worker.join();
+        }
+    }
+
+    void enqueue(const function<void()>& task)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (!m_worker.joinable())
+            {
+                m_worker = thread(&AsyncExecutor::run, this);
+            }
+            m_tasks.push_back(task);
+        }
+        m_condition.notify_all();
+    }
+
+    void begin_call()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_pending_calls++;
+    }
+
+    void end_call()
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_pending_calls--;
+        }
+        m_condition.notify_all();
+    }
+
+    void wait()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] { return m_pending_calls == 0; });
+    }
+
+private:
+    void run()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        while (true)
+        {
+            m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            function<void()> task = move(m_tasks.front());
+            m_tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    mutex m_mutex;
+    condition_variable m_condition;
+    deque<function<void()>> m_tasks;
+    size_t m_pending_calls = 0;
+    bool m_stop = false;
+    thread m_worker;
+};
+
+runtime::Backend::Backend()
+    : m_async_executor(new AsyncExecutor())
+{
+}
+
 runtime::Backend::~Backend()
 {
 }
@@ -39,6 +128,71 @@ vector<string> runtime::Backend::get_registered_devices()
     return BackendManager::get_registered_backends();
 }
 
+future<bool> runtime::Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs,
+                                          const function<void(bool, exception_ptr)>& callback)
+{
+    auto result = make_shared<promise<bool>>();
+    future<bool> future_result = result->get_future();
+    m_async_executor->begin_call();
+    auto task = [this, func, outputs, inputs, callback, result]() {
+        bool rc = false;
+        exception_ptr error;
+        try
+        {
+            rc = call(func, outputs, inputs);
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        if (callback)
+        {
+            try
+            {
+                callback(rc, error);
+            }
+            catch (...)
+            {
+                if (!error)
+                {
+                    error = current_exception();
+                }
+            }
+        }
+        if (error)
+        {
+            result->set_exception(error);
+        }
+        else
+        {
+            result->set_value(rc);
+        }
+        m_async_executor->end_call();
+    };
+    try
+    {
+        enqueue_async_task(task);
+    }
+    catch (...)
+    {
+        m_async_executor->end_call();
+        throw;
+    }
+    return future_result;
+}
+
+void runtime::Backend::enqueue_async_task(const function<void()>& task)
+{
+    m_async_executor->enqueue(task);
+}
+
+void runtime::Backend::wait_for_async_calls()
+{
+    m_async_executor->wait();
+}
+
 void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
@@ -49,6 +203,202 @@ vector<ngraph::runtime::PerformanceCounter>
     return vector<PerformanceCounter>();
 }
 
+void runtime::Backend::copy_batch_slices(const shared_ptr<runtime::TensorView>& src,
+                                         size_t src_first,
+                                         const shared_ptr<runtime::TensorView>& dst,
+                                         size_t dst_first,
+                                         size_t count,
+                                         size_t axis,
+                                         vector<char>& buffer)
+{
+    const Shape& dst_shape = dst->get_shape();
+    size_t outer = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= dst_shape[i];
+    }
+    size_t slice_bytes = dst->get_tensor().get_element_type().size();
+    for (size_t i = axis + 1; i < dst_shape.size(); i++)
+    {
+        slice_bytes *= dst_shape[i];
+    }
+    size_t src_slices = (src ? src->get_shape()[axis] : 0);
+    size_t dst_slices = dst_shape[axis];
+    size_t bytes = count * slice_bytes;
+    if (buffer.size() < bytes)
+    {
+        buffer.resize(bytes);
+    }
+    if (!src)
+    {
+        fill(buffer.begin(), buffer.begin() + bytes, 0);
+    }
+    for (size_t i = 0; i < outer; i++)
+    {
+        if (src)
+        {
+            src->read(buffer.data(), (i * src_slices + src_first) * slice_bytes, bytes);
+        }
+        dst->write(buffer.data(), (i * dst_slices + dst_first) * slice_bytes, bytes);
+    }
+}
+
+bool runtime::Backend::call_batch(shared_ptr<Function> func,
+                                  const vector<vector<shared_ptr<runtime::TensorView>>>& outputs,
+                                  const vector<vector<shared_ptr<runtime::TensorView>>>& inputs)
+{
+    if (!func->has_batch_axis())
+    {
+        throw runtime_error("Batched call requires a Function with a batch axis");
+    }
+    if (outputs.size() != inputs.size())
+    {
+        stringstream ss;
+        ss << "Batched call has " << inputs.size() << " input sets but " << outputs.size()
+           << " output sets";
+        throw runtime_error(ss.str());
+    }
+    if (inputs.empty())
+    {
+        return true;
+    }
+
+    size_t axis = func->get_batch_axis();
+    size_t batch_size = func->get_batch_size();
+    const op::ParameterVector& parameters = func->get_parameters();
+
+    // Number of batch slices contributed by each request
+    vector<size_t> request_slices(inputs.size());
+    for (size_t r = 0; r < inputs.size(); r++)
+    {
+        if (inputs[r].size() != parameters.size() || outputs[r].size() != func->get_output_size())
+        {
+            stringstream ss;
+            ss << "Request " << r << " has " << inputs[r].size() << " inputs and "
+               << outputs[r].size() << " outputs, Function has " << parameters.size()
+               << " Parameters and " << func->get_output_size() << " Results";
+            throw runtime_error(ss.str());
+        }
+        size_t slices = 0;
+        auto check_tensor = [&](const shared_ptr<runtime::TensorView>& tv,
+                                const element::Type& element_type,
+                                const Shape& shape) {
+            const Shape& tv_shape = tv->get_shape();
+            bool match = (tv->get_tensor().get_element_type() == element_type &&
+                          tv_shape.size() == shape.size());
+            for (size_t i = 0; match && i < shape.size(); i++)
+            {
+                match = (i == axis || tv_shape[i] == shape[i]);
+            }
+            if (match && slices == 0)
+            {
+                slices = tv_shape[axis];
+            }
+            if (!match || tv_shape[axis] != slices)
+            {
+                stringstream ss;
+                ss << "Request " << r << " tensor shape {" << join(tv_shape)
+                   << "} is not a batch of shape {" << join(shape) << "} along axis " << axis;
+                throw runtime_error(ss.str());
+            }
+        };
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            if (func->is_batched_parameter(i))
+            {
+                check_tensor(
+                    inputs[r][i], parameters[i]->get_element_type(), parameters[i]->get_shape());
+            }
+            else if (inputs[r][i] != inputs[0][i])
+            {
+                stringstream ss;
+                ss << "Request " << r << " input " << i
+                   << " is not batched and must be shared by all requests";
+                throw runtime_error(ss.str());
+            }
+        }
+        for (size_t i = 0; i < outputs[r].size(); i++)
+        {
+            check_tensor(
+                outputs[r][i], func->get_output_element_type(i), func->get_output_shape(i));
+        }
+        if (slices == 0 || slices > batch_size)
+        {
+            stringstream ss;
+            ss << "Request " << r << " batch of " << slices << " does not fit in batch size "
+               << batch_size;
+            throw runtime_error(ss.str());
+        }
+        request_slices[r] = slices;
+    }
+
+    vector<shared_ptr<runtime::TensorView>> batch_inputs;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        batch_inputs.push_back(func->is_batched_parameter(i)
+                                   ? create_tensor(parameters[i]->get_element_type(),
+                                                   parameters[i]->get_shape())
+                                   : inputs[0][i]);
+    }
+    vector<shared_ptr<runtime::TensorView>> batch_outputs;
+    for (size_t i = 0; i < func->get_output_size(); i++)
+    {
+        batch_outputs.push_back(
+            create_tensor(func->get_output_element_type(i), func->get_output_shape(i)));
+    }
+
+    vector<char> buffer;
+    size_t first = 0;
+    while (first < inputs.size())
+    {
+        // Greedily take consecutive requests that fit in one batch
+        size_t last = first;
+        size_t slices = 0;
+        while (last < inputs.size() && slices + request_slices[last] <= batch_size)
+        {
+            slices += request_slices[last++];
+        }
+
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            if (!func->is_batched_parameter(i))
+            {
+                continue;
+            }
+            size_t offset = 0;
+            for (size_t r = first; r < last; r++)
+            {
+                copy_batch_slices(
+                    inputs[r][i], 0, batch_inputs[i], offset, request_slices[r], axis, buffer);
+                offset += request_slices[r];
+            }
+            if (offset < batch_size)
+            {
+                copy_batch_slices(
+                    nullptr, 0, batch_inputs[i], offset, batch_size - offset, axis, buffer);
+            }
+        }
+
+        if (!call(func, batch_outputs, batch_inputs))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < batch_outputs.size(); i++)
+        {
+            size_t offset = 0;
+            for (size_t r = first; r < last; r++)
+            {
+                copy_batch_slices(
+                    batch_outputs[i], offset, outputs[r][i], 0, request_slices[r], axis, buffer);
+                offset += request_slices[r];
+            }
+        }
+        first = last;
+    }
+    return true;
+}
+
 void runtime::Backend::validate_call(shared_ptr<const Function> function,
                                      const vector<shared_ptr<runtime::TensorView>>& outputs,
                                      const vector<shared_ptr<runtime::TensorView>>& inputs)
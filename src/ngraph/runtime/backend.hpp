@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 
 #include "ngraph/function.hpp"
@@ -39,6 +42,7 @@ namespace ngraph
 class ngraph::runtime::Backend
 {
 public:
+    Backend();
     virtual ~Backend();
     /// \brief Create a new Backend object
     /// \param type The name of a registered backend, such as "CPU" or "GPU".
@@ -102,6 +106,34 @@ public:
         return call(func, outputs, inputs);
     }
 
+    /// \brief Executes a Function on many independent requests. Requests are concatenated along
+    ///     the Function's batch axis (see Function::set_batch_axis) into batches of at most
+    ///     the Function's batch size, each batch runs as a single call and the results are
+    ///     scattered back to the requests' outputs. Inputs of parameters that are not batched
+    ///     must be the same tensor in every request.
+    /// \param func The function to execute
+    /// \param outputs outputs[i] are the output tensors of request i
+    /// \param inputs inputs[i] are the input tensors of request i
+    /// \returns true if all iterations are successful, false otherwise
+    virtual bool
+        call_batch(std::shared_ptr<Function> func,
+                   const std::vector<std::vector<std::shared_ptr<runtime::TensorView>>>& outputs,
+                   const std::vector<std::vector<std::shared_ptr<runtime::TensorView>>>& inputs);
+
+    /// \brief Executes a single iteration of a Function without blocking the caller. Calls are
+    ///     run by an executor owned by the backend. The input tensors must not be modified and
+    ///     the output tensors must not be read until the call completes, and all calls must
+    ///     complete before the backend is destroyed.
+    /// \param func The function to execute
+    /// \param callback Optional function invoked on the executing thread once the call
+    ///     completes, with the call's result and the exception it threw, if any
+    /// \returns A future holding the call's result or the exception it threw
+    std::future<bool>
+        call_async(std::shared_ptr<Function> func,
+                   const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::TensorView>>& inputs,
+                   const std::function<void(bool, std::exception_ptr)>& callback = nullptr);
+
     /// \brief Compiled functions may be cached. This function removes a compiled function
     ///     from the cache.
     /// \param func The function to execute
@@ -119,7 +151,28 @@ public:
         get_performance_data(std::shared_ptr<Function> func) const;
 
 protected:
+    /// \brief Run a task of call_async. The default runs tasks in submission order on a
+    ///     thread owned by the backend.
+    virtual void enqueue_async_task(const std::function<void()>& task);
+    /// \brief Block until all calls made with call_async have completed. Pending calls
+    ///     use the derived backend, so every backend calls this from its own destructor.
+    void wait_for_async_calls();
+
     void validate_call(std::shared_ptr<const Function> func,
                        const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                        const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
+    /// \brief Copy `count` slices along `axis` from slice `src_first` of src to slice
+    ///     `dst_first` of dst. A null src fills the destination slices with zeros.
+    static void copy_batch_slices(const std::shared_ptr<runtime::TensorView>& src,
+                                  size_t src_first,
+                                  const std::shared_ptr<runtime::TensorView>& dst,
+                                  size_t dst_first,
+                                  size_t count,
+                                  size_t axis,
+                                  std::vector<char>& buffer);
+
+private:
+    class AsyncExecutor;
+    std::unique_ptr<AsyncExecutor> m_async_executor;
 };
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/batch_coalescer.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::BatchCoalescer::BatchCoalescer(const shared_ptr<Backend>& backend,
+                                        const shared_ptr<Function>& func,
+                                        chrono::microseconds max_delay)
+    : m_backend(backend)
+    , m_function(func)
+    , m_max_delay(max_delay)
+    , m_batch_size(func->get_batch_size())
+    , m_pending_slices(0)
+    , m_stop(false)
+{
+    m_worker = thread(&BatchCoalescer::run, this);
+}
+
+runtime::BatchCoalescer::~BatchCoalescer()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    m_worker.join();
+}
+
+future<bool> runtime::BatchCoalescer::submit(const TensorViewPtrs& outputs,
+                                             const TensorViewPtrs& inputs)
+{
+    if (outputs.empty())
+    {
+        throw ngraph_error("Batched request must have at least one output");
+    }
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    request.slices = outputs[0]->get_shape().at(m_function->get_batch_axis());
+    request.submitted = chrono::steady_clock::now();
+    future<bool> result = request.promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_pending_slices += request.slices;
+        m_pending.push_back(move(request));
+    }
+    m_condition.notify_one();
+    return result;
+}
+
+void runtime::BatchCoalescer::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] { return m_stop || !m_pending.empty(); });
+        if (m_pending.empty())
+        {
+            // Stopped with nothing left to run
+            return;
+        }
+
+        // Wait for a full batch or for the oldest request's deadline
+        auto deadline = m_pending.front().submitted + m_max_delay;
+        m_condition.wait_until(
+            lock, deadline, [this] { return m_stop || m_pending_slices >= m_batch_size; });
+
+        // Take the queued requests that fit in one batch; oversized requests are taken alone
+        // so call_batch reports the error on their future.
+        vector<Request> batch;
+        size_t slices = 0;
+        while (!m_pending.empty() &&
+               (batch.empty() || slices + m_pending.front().slices <= m_batch_size))
+        {
+            slices += m_pending.front().slices;
+            m_pending_slices -= m_pending.front().slices;
+            batch.push_back(move(m_pending.front()));
+            m_pending.pop_front();
+        }
+
+        lock.unlock();
+        vector<TensorViewPtrs> outputs;
+        vector<TensorViewPtrs> inputs;
+        for (Request& request : batch)
+        {
+            outputs.push_back(request.outputs);
+            inputs.push_back(request.inputs);
+        }
+        try
+        {
+            bool rc = m_backend->call_batch(m_function, outputs, inputs);
+            for (Request& request : batch)
+            {
+                request.promise.set_value(rc);
+            }
+        }
+        catch (...)
+        {
+            for (Request& request : batch)
+            {
+                request.promise.set_exception(current_exception());
+            }
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class BatchCoalescer;
+    }
+}
+
+/// \brief Coalesces independent requests to a Function into batched calls.
+///
+/// Requests submitted from any thread are queued and run by a worker thread with
+/// Backend::call_batch. A batch is dispatched when the queued requests fill the Function's
+/// batch size or when the oldest queued request has waited for the maximum delay.
+class ngraph::runtime::BatchCoalescer
+{
+public:
+    /// \brief Create a coalescer for a Function with a declared batch axis
+    /// \param backend The backend that runs the batched calls
+    /// \param func The function to execute
+    /// \param max_delay The longest time a request waits for other requests to batch with
+    BatchCoalescer(const std::shared_ptr<Backend>& backend,
+                   const std::shared_ptr<Function>& func,
+                   std::chrono::microseconds max_delay = std::chrono::microseconds(500));
+    ~BatchCoalescer();
+
+    /// \brief Queue one request
+    /// \param outputs The output tensors of the request
+    /// \param inputs The input tensors of the request
+    /// \returns A future that becomes ready once the outputs are written. It holds the result
+    ///     of the batched call or the exception it threw.
+    std::future<bool> submit(const TensorViewPtrs& outputs, const TensorViewPtrs& inputs);
+
+private:
+    BatchCoalescer(const BatchCoalescer&) = delete;
+    BatchCoalescer& operator=(const BatchCoalescer&) = delete;
+
+    struct Request
+    {
+        TensorViewPtrs outputs;
+        TensorViewPtrs inputs;
+        size_t slices;
+        std::chrono::steady_clock::time_point submitted;
+        std::promise<bool> promise;
+    };
+
+    void run();
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    std::chrono::microseconds m_max_delay;
+    size_t m_batch_size;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<Request> m_pending;
+    size_t m_pending_slices;
+    bool m_stop;
+    std::thread m_worker;
+};
@@ -33,8 +33,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto count = static_cast<int>(out[0].get_size());
                 auto data_type = MPI_FLOAT;
 
@@ -47,9 +47,14 @@ namespace ngraph
                     data_type = MPI_DOUBLE;
                 }
 
-                auto functor = [&, count, data_type](CPURuntimeContext* ctx) {
-                    MPI_Allreduce(
-                        arg_tensor, out_tensor, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+                auto functor = [&, count, data_type, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    MPI_Allreduce(ctx->buffer_data[arg_buffer_index],
+                                  ctx->buffer_data[out_buffer_index],
+                                  count,
+                                  data_type,
+                                  MPI_SUM,
+                                  MPI_COMM_WORLD);
                 };
 
                 functors.emplace_back(functor);
@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
 #include "ngraph/op/argmin.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/argmin.hpp"
+#include "ngraph/runtime/cpu/kernel/argmin.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,13 +31,11 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::ArgMin)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::ArgMin* argmin = static_cast<const ngraph::op::ArgMin*>(node);
-                function<void(CPURuntimeContext*)> functor;
 
-                auto& arg_tensor = tensor_data[args[0].get_name()];
-                auto& out_tensor = tensor_data[out[0].get_name()];
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 if (out[0].get_element_type() != element::i64 &&
                     out[0].get_element_type() != element::i32)
                 {
@@ -48,57 +44,30 @@ namespace ngraph
                 bool is_int64 = out[0].get_element_type() == element::i64;
                 auto axis = argmin->get_reduction_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
+
+                std::function<decltype(runtime::cpu::kernel::argmin<float, int64_t>)> kernel;
 
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
                     if (is_int64)
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
-                            ngraph::runtime::reference::argmin<float, int64_t>(
-                                static_cast<float*>(arg_tensor),
-                                static_cast<int64_t*>(out_tensor),
-                                in_shape,
-                                out_shape,
-                                axis);
-                        };
+                        kernel = runtime::cpu::kernel::argmin<float, int64_t>;
                     }
                     else
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
-                            ngraph::runtime::reference::argmin<float, int32_t>(
-                                static_cast<float*>(arg_tensor),
-                                static_cast<int*>(out_tensor),
-                                in_shape,
-                                out_shape,
-                                axis);
-                        };
+                        kernel = runtime::cpu::kernel::argmin<float, int32_t>;
                     }
                 }
                 else if (element_type == element::f64)
                 {
                     if (is_int64)
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
-                            ngraph::runtime::reference::argmin<double, int64_t>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<int64_t*>(out_tensor),
-                                in_shape,
-                                out_shape,
-                                axis);
-                        };
+                        kernel = runtime::cpu::kernel::argmin<double, int64_t>;
                     }
                     else
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
-                            ngraph::runtime::reference::argmin<double, int32_t>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<int*>(out_tensor),
-                                in_shape,
-                                out_shape,
-                                axis);
-                        };
+                        kernel = runtime::cpu::kernel::argmin<double, int32_t>;
                     }
                 }
                 else
@@ -106,6 +75,13 @@ namespace ngraph
                     throw ngraph_error("Unsupported type in CPU Builder for ArgMin");
                 }
 
+                auto functor = [&, kernel, in_shape, axis, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           in_shape,
+                           axis);
+                };
                 functors.emplace_back(functor);
             }
 
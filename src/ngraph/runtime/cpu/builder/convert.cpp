@@ -32,8 +32,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto element_count = out[0].get_size();
 
@@ -101,8 +101,11 @@ namespace ngraph
                     throw ngraph_error("Cannot convert from an invalid input element type");
                 }
 
-                auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
-                    kernel(arg_tensor, out_tensor, element_count);
+                auto functor = [&, kernel, element_count, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           element_count);
                 };
                 functors.emplace_back(functor);
             }
@@ -0,0 +1,251 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <unordered_map>
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            using runtime::cpu::kernel::LoopKernelOpcode;
+
+            static const unordered_map<type_index, LoopKernelOpcode> s_loop_kernel_opcodes{
+                {TI(ngraph::op::Abs), LoopKernelOpcode::Abs},
+                {TI(ngraph::op::Negative), LoopKernelOpcode::Negative},
+                {TI(ngraph::op::Relu), LoopKernelOpcode::Relu},
+                {TI(ngraph::op::Sqrt), LoopKernelOpcode::Sqrt},
+                {TI(ngraph::op::Exp), LoopKernelOpcode::Exp},
+                {TI(ngraph::op::Log), LoopKernelOpcode::Log},
+                {TI(ngraph::op::Tanh), LoopKernelOpcode::Tanh},
+                {TI(ngraph::op::Sigmoid), LoopKernelOpcode::Sigmoid},
+                {TI(ngraph::op::Add), LoopKernelOpcode::Add},
+                {TI(ngraph::op::Subtract), LoopKernelOpcode::Subtract},
+                {TI(ngraph::op::Multiply), LoopKernelOpcode::Multiply},
+                {TI(ngraph::op::Divide), LoopKernelOpcode::Divide},
+                {TI(ngraph::op::Maximum), LoopKernelOpcode::Maximum},
+                {TI(ngraph::op::Minimum), LoopKernelOpcode::Minimum},
+                {TI(ngraph::op::Broadcast), LoopKernelOpcode::Splat}};
+
+            // GOEE doesn't see GOEs in subgraphs that are hidden inside LoopKernels
+            // we have to manually propagate the source output
+            static const descriptor::Output*
+                get_loop_kernel_source(const descriptor::Output* output)
+            {
+                while (auto goe =
+                           dynamic_pointer_cast<ngraph::op::GetOutputElement>(output->get_node()))
+                {
+                    output = &goe->get_inputs().at(goe->get_n()).get_output();
+                }
+                return output;
+            }
+
+            // Translates the node list of a LoopKernel into register code. Intermediate values
+            // get scratch registers that are recycled as soon as their last user has run.
+            static kernel::LoopKernelProgram
+                compile_loop_kernel(const ngraph::runtime::cpu::op::LoopKernel* loop_kernel)
+            {
+                kernel::LoopKernelProgram program;
+                const NodeVector& node_list = loop_kernel->get_node_list();
+                const NodeVector& output_nodes = loop_kernel->get_kernel_outputs();
+                size_t count = shape_size(loop_kernel->get_output_shape(0));
+
+                program.input_count = loop_kernel->get_input_size();
+                program.output_count = output_nodes.size();
+                size_t tensor_count = program.input_count + program.output_count;
+
+                unordered_map<const descriptor::Output*, size_t> registers;
+                for (size_t i = 0; i < program.input_count; i++)
+                {
+                    auto& input = loop_kernel->get_inputs().at(i);
+                    registers[get_loop_kernel_source(&input.get_output())] = i;
+                    program.scalar_inputs.push_back(shape_size(input.get_shape()) != count);
+                }
+                for (size_t i = 0; i < output_nodes.size(); i++)
+                {
+                    registers[&output_nodes.at(i)->get_outputs().at(0)] = program.input_count + i;
+                }
+
+                // Position of the last member reading each value
+                unordered_map<const descriptor::Output*, size_t> last_use;
+                for (size_t i = 0; i < node_list.size(); i++)
+                {
+                    for (auto& input : node_list[i]->get_inputs())
+                    {
+                        last_use[get_loop_kernel_source(&input.get_output())] = i;
+                    }
+                }
+
+                vector<size_t> free_registers;
+                for (size_t i = 0; i < node_list.size(); i++)
+                {
+                    const Node& node = *node_list[i];
+                    auto opcode = s_loop_kernel_opcodes.find(TI(node));
+                    if (opcode == s_loop_kernel_opcodes.end())
+                    {
+                        throw ngraph_error("Unsupported op in LoopKernel: " + node.description());
+                    }
+                    if (node.get_outputs().size() != 1 || node.get_inputs().size() > 2)
+                    {
+                        throw ngraph_error("Unsupported node in LoopKernel: " + node.get_name());
+                    }
+
+                    kernel::LoopKernelInstruction instruction{opcode->second, 0, 0, 0};
+                    vector<size_t> arg_registers;
+                    for (auto& input : node.get_inputs())
+                    {
+                        auto source = get_loop_kernel_source(&input.get_output());
+                        auto reg = registers.find(source);
+                        if (reg == registers.end())
+                        {
+                            throw ngraph_error("LoopKernel member " + node.get_name() +
+                                               " reads a value computed outside of the kernel");
+                        }
+                        bool is_input = (reg->second < program.input_count);
+                        bool is_scalar = (is_input && program.scalar_inputs[reg->second]);
+                        if (instruction.opcode == LoopKernelOpcode::Splat ? !is_input : is_scalar)
+                        {
+                            throw ngraph_error("LoopKernel can only broadcast scalar inputs");
+                        }
+                        arg_registers.push_back(reg->second);
+                    }
+                    instruction.arg0 = arg_registers.at(0);
+                    instruction.arg1 = arg_registers.back();
+
+                    if (!node.get_element_type().is_real() &&
+                        instruction.opcode >= LoopKernelOpcode::Sqrt &&
+                        instruction.opcode <= LoopKernelOpcode::Sigmoid)
+                    {
+                        throw ngraph_error("Unsupported type in LoopKernel for " + node.get_name());
+                    }
+
+                    auto output = &node.get_outputs().at(0);
+                    auto reg = registers.find(output);
+                    if (reg != registers.end())
+                    {
+                        instruction.result = reg->second;
+                    }
+                    else
+                    {
+                        if (free_registers.empty())
+                        {
+                            free_registers.push_back(tensor_count + program.scratch_count++);
+                        }
+                        instruction.result = free_registers.back();
+                        free_registers.pop_back();
+                        registers[output] = instruction.result;
+                    }
+                    program.instructions.push_back(instruction);
+
+                    // Release scratch registers whose values are dead after this instruction
+                    for (auto& input : node.get_inputs())
+                    {
+                        auto source = get_loop_kernel_source(&input.get_output());
+                        size_t arg_register = registers.at(source);
+                        if (arg_register >= tensor_count && last_use.at(source) == i &&
+                            find(free_registers.begin(), free_registers.end(), arg_register) ==
+                                free_registers.end())
+                        {
+                            free_registers.push_back(arg_register);
+                        }
+                    }
+                }
+                return program;
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                auto& functors = external_function->get_functors();
+
+                const ngraph::runtime::cpu::op::LoopKernel* loop_kernel =
+                    static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+
+                auto program = compile_loop_kernel(loop_kernel);
+
+                vector<size_t> buffer_indices;
+                for (auto& arg : args)
+                {
+                    auto index = external_function->get_buffer_index(arg.get_name());
+                    buffer_indices.push_back(index);
+                }
+                for (auto& result : out)
+                {
+                    auto index = external_function->get_buffer_index(result.get_name());
+                    buffer_indices.push_back(index);
+                }
+                size_t count = out[0].get_size();
+
+                std::function<decltype(runtime::cpu::kernel::loop_kernel<float>)> kernel;
+
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<double>;
+                }
+                else if (element_type == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<int32_t>;
+                }
+                else if (element_type == element::i64)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<int64_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for LoopKernel");
+                }
+
+                auto functor = [&, kernel, program, buffer_indices, count](
+                    CPURuntimeContext* ctx) {
+                    kernel(program, ctx->buffer_data, buffer_indices, count);
+                };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
@@ -37,8 +37,8 @@ namespace ngraph
                 const ngraph::op::LRN* lrn = static_cast<const ngraph::op::LRN*>(node);
                 function<void(CPURuntimeContext*)> functor;
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
@@ -55,9 +55,12 @@ namespace ngraph
                                                           static_cast<int>(lrn->get_nsize()));
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(lrn_index);
-                    functor = [&, lrn_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    functor = [&, lrn_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, lrn_index);
                     };
                 }
@@ -72,22 +75,37 @@ namespace ngraph
                     auto element_type = lrn->get_element_type();
                     if (element_type == element::f32)
                     {
-                        functor = [&, alpha, beta, bias, arg_shape, nsize](CPURuntimeContext* ctx) {
-                            ngraph::runtime::reference::lrn<float>(static_cast<float*>(arg_tensor),
-                                                                   static_cast<float*>(out_tensor),
-                                                                   arg_shape,
-                                                                   alpha,
-                                                                   beta,
-                                                                   bias,
-                                                                   nsize);
+                        functor = [&,
+                                   alpha,
+                                   beta,
+                                   bias,
+                                   arg_shape,
+                                   nsize,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx) {
+                            ngraph::runtime::reference::lrn<float>(
+                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                arg_shape,
+                                alpha,
+                                beta,
+                                bias,
+                                nsize);
                         };
                     }
                     else if (element_type == element::f64)
                     {
-                        functor = [&, alpha, beta, bias, arg_shape, nsize](CPURuntimeContext* ctx) {
+                        functor = [&,
+                                   alpha,
+                                   beta,
+                                   bias,
+                                   arg_shape,
+                                   nsize,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx) {
                             ngraph::runtime::reference::lrn<double>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<double*>(out_tensor),
+                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 arg_shape,
                                 alpha,
                                 beta,
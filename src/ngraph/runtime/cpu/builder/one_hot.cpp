@@ -39,16 +39,24 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 if (arg_rank == 0)
                 {
                     std::function<decltype(runtime::cpu::kernel::one_hot_rank_0<float>)> kernel;
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::one_hot_rank_0);
-                    auto functor = [&, kernel, out_shape, one_hot_axis](CPURuntimeContext* ctx) {
-                        kernel(arg_tensor, out_tensor, out_shape, one_hot_axis);
+                    auto functor = [&,
+                                    kernel,
+                                    out_shape,
+                                    one_hot_axis,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               out_shape,
+                               one_hot_axis);
                     };
 
                     functors.emplace_back(functor);
@@ -58,10 +66,16 @@ namespace ngraph
                     std::function<decltype(runtime::cpu::kernel::one_hot_rank_1<float>)> kernel;
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::one_hot_rank_1);
-                    auto functor = [&, kernel, arg_shape, out_shape, out_strides, one_hot_axis](
-                        CPURuntimeContext* ctx) {
-                        kernel(arg_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg_shape,
+                                    out_shape,
+                                    out_strides,
+                                    one_hot_axis,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg_shape,
                                out_shape,
                                out_strides,
@@ -77,10 +91,19 @@ namespace ngraph
                     SELECT_KERNEL(kernel,
                                   out[0].get_element_type(),
                                   runtime::cpu::kernel::one_hot_rank_2_or_more);
-                    auto functor =
-                        [&, kernel, arg_shape, out_shape, one_hot_axis](CPURuntimeContext* ctx) {
-                            kernel(arg_tensor, out_tensor, arg_shape, out_shape, one_hot_axis);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg_shape,
+                                    out_shape,
+                                    one_hot_axis,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg_shape,
+                               out_shape,
+                               one_hot_axis);
+                    };
 
                     functors.emplace_back(functor);
                 }
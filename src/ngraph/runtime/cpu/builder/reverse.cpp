@@ -34,8 +34,8 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg_shape = args[0].get_shape();
                 auto result_shape = out[0].get_shape();
@@ -45,10 +45,19 @@ namespace ngraph
 
                 SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::reverse);
 
-                auto functor =
-                    [&, kernel, arg_shape, result_shape, reversed_axes](CPURuntimeContext* ctx) {
-                        kernel(arg_tensor, out_tensor, arg_shape, result_shape, reversed_axes);
-                    };
+                auto functor = [&,
+                                kernel,
+                                arg_shape,
+                                result_shape,
+                                reversed_axes,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg_shape,
+                           result_shape,
+                           reversed_axes);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -35,8 +35,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto input_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -57,9 +57,12 @@ namespace ngraph
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(sigmoid_index);
 
-                auto functor = [&, sigmoid_index](CPURuntimeContext* ctx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                auto functor = [&, sigmoid_index, arg0_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, sigmoid_index);
                 };
                 functors.emplace_back(functor);
@@ -70,9 +73,9 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto input_shape = args[0].get_shape();
                 auto delta_shape = args[1].get_shape();
@@ -99,10 +102,17 @@ namespace ngraph
                     mkldnn_emitter->build_sigmoid_backward(input_desc, delta_desc, out_desc);
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(sigmoid_index);
-                auto functor = [&, sigmoid_index](CPURuntimeContext* ctx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
+                auto functor = [&,
+                                sigmoid_index,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[arg1_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[out_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, sigmoid_index);
                 };
                 functors.emplace_back(functor);
@@ -112,11 +122,10 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::SigmoidMultiply)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
-                auto& arg0_tensor = tensor_data[args[0].get_name()];
-                auto& arg1_tensor = tensor_data[args[1].get_name()];
-                auto& out_tensor = tensor_data[out[0].get_name()];
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto tensor_size = shape_size(args[0].get_shape());
 
                 auto sigmoid_mul = static_cast<const ngraph::op::SigmoidMultiply*>(node);
@@ -126,9 +135,18 @@ namespace ngraph
                         static_cast<size_t>(ngraph::op::SigmoidMultiply::FunctionType::NumTypes) +
                     static_cast<size_t>(sigmoid_mul->get_input_func_type(1));
 
-                auto functor = [&, index, tensor_size](CPURuntimeContext* ctx) {
+                auto functor = [&,
+                                index,
+                                tensor_size,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
                     ngraph::runtime::cpu::kernel::sigmoid_multiply(
-                        arg0_tensor, arg1_tensor, out_tensor, tensor_size, index);
+                        ctx->buffer_data[arg0_buffer_index],
+                        ctx->buffer_data[arg1_buffer_index],
+                        ctx->buffer_data[out_buffer_index],
+                        tensor_size,
+                        index);
                 };
 
                 functors.emplace_back(functor);
@@ -138,13 +156,12 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::SigmoidMultiplyBackprop)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
-                auto& arg0_tensor = tensor_data[args[0].get_name()];
-                auto& arg1_tensor = tensor_data[args[1].get_name()];
-                auto& arg2_tensor = tensor_data[args[2].get_name()];
-                auto& out0_tensor = tensor_data[out[0].get_name()];
-                auto& out1_tensor = tensor_data[out[1].get_name()];
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
                 auto tensor_size = shape_size(args[0].get_shape());
 
                 auto sigmoid_mul = static_cast<const ngraph::op::SigmoidMultiplyBackprop*>(node);
@@ -154,14 +171,22 @@ namespace ngraph
                         static_cast<size_t>(ngraph::op::SigmoidMultiply::FunctionType::NumTypes) +
                     static_cast<size_t>(sigmoid_mul->get_input_func_type(1));
 
-                auto functor = [&, index, tensor_size](CPURuntimeContext* ctx) {
-                    ngraph::runtime::cpu::kernel::sigmoid_multiply_backprop(arg0_tensor,
-                                                                            arg1_tensor,
-                                                                            arg2_tensor,
-                                                                            out0_tensor,
-                                                                            out1_tensor,
-                                                                            tensor_size,
-                                                                            index);
+                auto functor = [&,
+                                index,
+                                tensor_size,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out0_buffer_index,
+                                out1_buffer_index](CPURuntimeContext* ctx) {
+                    ngraph::runtime::cpu::kernel::sigmoid_multiply_backprop(
+                        ctx->buffer_data[arg0_buffer_index],
+                        ctx->buffer_data[arg1_buffer_index],
+                        ctx->buffer_data[arg2_buffer_index],
+                        ctx->buffer_data[out0_buffer_index],
+                        ctx->buffer_data[out1_buffer_index],
+                        tensor_size,
+                        index);
                 };
 
                 functors.emplace_back(functor);
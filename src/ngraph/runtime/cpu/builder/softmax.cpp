@@ -38,8 +38,8 @@ namespace ngraph
 
                 auto arg_shape = args[0].get_shape();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto axes = softmax->get_axes();
 
@@ -60,9 +60,12 @@ namespace ngraph
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(softmax_index);
 
-                    auto functor = [&, softmax_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, softmax_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, softmax_index);
                     };
                     functors.emplace_back(functor);
@@ -78,8 +81,11 @@ namespace ngraph
                                                       args[0].get_shape().size(),
                                                       runtime::cpu::kernel::softmax_all);
 
-                        auto functor = [&, kernel, arg_shape](CPURuntimeContext* ctx) {
-                            kernel(arg_tensor, out_tensor, arg_shape);
+                        auto functor = [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
+                            CPURuntimeContext* ctx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   arg_shape);
                         };
                         functors.emplace_back(functor);
                     }
@@ -97,8 +103,14 @@ namespace ngraph
                                 args[0].get_shape().size(),
                                 runtime::cpu::kernel::softmax_innermost_1rd);
 
-                            auto functor = [&, kernel, arg_shape](CPURuntimeContext* ctx) {
-                                kernel(arg_tensor, out_tensor, arg_shape);
+                            auto functor = [&,
+                                            kernel,
+                                            arg_shape,
+                                            arg_buffer_index,
+                                            out_buffer_index](CPURuntimeContext* ctx) {
+                                kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
+                                       arg_shape);
                             };
                             functors.emplace_back(functor);
                         }
@@ -112,8 +124,16 @@ namespace ngraph
                                                           args[0].get_shape().size(),
                                                           runtime::cpu::kernel::softmax_1rd);
 
-                            auto functor = [&, kernel, arg_shape, axes](CPURuntimeContext* ctx) {
-                                kernel(arg_tensor, out_tensor, arg_shape, axes);
+                            auto functor = [&,
+                                            kernel,
+                                            arg_shape,
+                                            axes,
+                                            arg_buffer_index,
+                                            out_buffer_index](CPURuntimeContext* ctx) {
+                                kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
+                                       arg_shape,
+                                       axes);
                             };
                             functors.emplace_back(functor);
                         }
@@ -126,8 +146,16 @@ namespace ngraph
                                       args[0].get_element_type(),
                                       runtime::cpu::kernel::softmax_3d_2rd);
 
-                        auto functor = [&, kernel, arg_shape, axes](CPURuntimeContext* ctx) {
-                            kernel(arg_tensor, out_tensor, arg_shape, axes);
+                        auto functor = [&,
+                                        kernel,
+                                        arg_shape,
+                                        axes,
+                                        arg_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   arg_shape,
+                                   axes);
                         };
                         functors.emplace_back(functor);
                     }
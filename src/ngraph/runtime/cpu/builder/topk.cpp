@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,14 +33,14 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::TopK)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::TopK* topk = static_cast<const ngraph::op::TopK*>(node);
-                function<void(CPURuntimeContext*)> functor;
 
-                auto& arg_tensor = tensor_data[args[0].get_name()];
-                auto& out_indices_tensor = tensor_data[out[0].get_name()];
-                auto& out_values_tensor = tensor_data[out[1].get_name()];
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_indices_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto out_values_buffer_index =
+                    external_function->get_buffer_index(out[1].get_name());
                 if (out[0].get_element_type() != element::i64 &&
                     out[0].get_element_type() != element::i32)
                 {
@@ -49,75 +49,32 @@ namespace ngraph
                 bool is_int64 = out[0].get_element_type() == element::i64;
                 auto axis = topk->get_top_k_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
 
+                std::function<decltype(runtime::cpu::kernel::topk<float, int64_t>)> kernel;
+
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
                     if (is_int64)
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<float, int64_t>(
-                                    static_cast<float*>(arg_tensor),
-                                    static_cast<int64_t*>(out_indices_tensor),
-                                    static_cast<float*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        kernel = runtime::cpu::kernel::topk<float, int64_t>;
                     }
                     else
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<float, int32_t>(
-                                    static_cast<float*>(arg_tensor),
-                                    static_cast<int32_t*>(out_indices_tensor),
-                                    static_cast<float*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        kernel = runtime::cpu::kernel::topk<float, int32_t>;
                     }
                 }
                 else if (element_type == element::f64)
                 {
                     if (is_int64)
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<double, int64_t>(
-                                    static_cast<double*>(arg_tensor),
-                                    static_cast<int64_t*>(out_indices_tensor),
-                                    static_cast<double*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        kernel = runtime::cpu::kernel::topk<double, int64_t>;
                     }
                     else
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<double, int32_t>(
-                                    static_cast<double*>(arg_tensor),
-                                    static_cast<int32_t*>(out_indices_tensor),
-                                    static_cast<double*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        kernel = runtime::cpu::kernel::topk<double, int32_t>;
                     }
                 }
                 else
@@ -125,6 +82,23 @@ namespace ngraph
                     throw ngraph_error("Unsupported type in CPU Builder for TopK");
                 }
 
+                auto functor = [&,
+                                kernel,
+                                in_shape,
+                                axis,
+                                k,
+                                compute_max,
+                                arg_buffer_index,
+                                out_indices_buffer_index,
+                                out_values_buffer_index](CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_indices_buffer_index],
+                           ctx->buffer_data[out_values_buffer_index],
+                           in_shape,
+                           axis,
+                           k,
+                           compute_max);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+#include <sstream>
 #include <tbb/tbb_stddef.h>
 
 #include "ngraph/graph_util.hpp"
@@ -21,7 +23,9 @@
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -54,6 +58,21 @@ namespace
     } s_cpu_static_init;
 }
 
+runtime::cpu::CPU_Backend::CPU_Backend()
+    : m_max_specializations(8)
+{
+    const auto env_specializations = std::getenv("NGRAPH_CPU_SPECIALIZATIONS");
+    if (env_specializations != nullptr && std::atoi(env_specializations) > 0)
+    {
+        m_max_specializations = std::atoi(env_specializations);
+    }
+}
+
+runtime::cpu::CPU_Backend::~CPU_Backend()
+{
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
     const shared_ptr<runtime::cpu::CPU_ExternalFunction>& external_function)
 {
@@ -72,18 +91,49 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
     return make_shared<runtime::cpu::CPUTensorView>(element_type, shape, memory_pointer);
 }
 
-bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
+shared_ptr<runtime::cpu::CPU_Backend::FunctionInstance>
+    runtime::cpu::CPU_Backend::get_instance(shared_ptr<Function> func)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    std::lock_guard<std::mutex> lock(m_function_map_mutex);
+    auto& instance = m_function_map[func];
+    if (instance == nullptr)
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
+        instance = make_shared<FunctionInstance>();
+    }
+    return instance;
+}
+
+shared_ptr<runtime::cpu::CPU_Backend::FunctionInstance>
+    runtime::cpu::CPU_Backend::get_compiled_instance(shared_ptr<Function> func)
+{
+    auto instance = get_instance(func);
+    // Compilation runs outside of the map lock so other functions stay callable meanwhile;
+    // concurrent compilations of the same function wait for the first one
+    std::call_once(instance->m_compiled, [&]() {
+        auto external_function = make_shared<CPU_ExternalFunction>(func);
+        {
+            std::lock_guard<std::mutex> lock(m_function_map_mutex);
+            if (m_thread_pool != nullptr)
+            {
+                external_function->set_thread_pool(m_thread_pool);
+            }
 #if !defined(NGRAPH_DEX_ONLY)
-        instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
+            external_function->m_emit_timing = instance->m_performance_counters_enabled;
 #endif
-        auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
-    }
+        }
+        auto call_frame =
+            dynamic_pointer_cast<CPU_CallFrame>(external_function->make_call_frame());
+
+        std::lock_guard<std::mutex> lock(m_function_map_mutex);
+        instance->m_external_function = external_function;
+        instance->m_call_frame = call_frame;
+    });
+    return instance;
+}
+
+bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
+{
+    get_compiled_instance(func);
     return true;
 }
 
@@ -91,21 +141,240 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
                                      const vector<shared_ptr<runtime::TensorView>>& outputs,
                                      const vector<shared_ptr<runtime::TensorView>>& inputs)
 {
-    bool rc = true;
+    // Calls with another extent of the batch axis run a specialization of the function
+    if (func->has_batch_axis())
+    {
+        size_t axis = func->get_batch_axis();
+        for (size_t i = 0; i < inputs.size() && i < func->get_parameters().size(); i++)
+        {
+            if (func->is_batched_parameter(i) && axis < inputs[i]->get_shape().size() &&
+                inputs[i]->get_shape()[axis] != func->get_batch_size())
+            {
+                return call_with_batch(func, outputs, inputs, inputs[i]->get_shape()[axis]);
+            }
+        }
+    }
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    auto instance = get_compiled_instance(func);
+    shared_ptr<CPU_CallFrame> call_frame;
     {
-        rc = compile(func);
+        std::lock_guard<std::mutex> lock(m_function_map_mutex);
+        call_frame = instance->m_call_frame;
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    call_frame->call(outputs, inputs);
 
+    return true;
+}
+
+bool runtime::cpu::CPU_Backend::call_with_batch(
+    shared_ptr<Function> func,
+    const vector<shared_ptr<runtime::TensorView>>& outputs,
+    const vector<shared_ptr<runtime::TensorView>>& inputs,
+    size_t batch_size)
+{
+    // Batch sizes share the specialization of the next power of two, unless the padding
+    // slices could change the results of the others
+    size_t bucket_size = batch_size;
+    if (has_independent_batch_slices(func))
+    {
+        bucket_size = 1;
+        while (bucket_size < batch_size)
+        {
+            bucket_size <<= 1;
+        }
+    }
+    auto specialized =
+        (bucket_size == func->get_batch_size() ? func : get_specialization(func, bucket_size));
+    size_t axis = func->get_batch_axis();
+
+    auto check_shape = [&](const shared_ptr<runtime::TensorView>& tv,
+                           const Shape& shape,
+                           const string& what) {
+        Shape expected = shape;
+        expected.at(axis) = batch_size;
+        if (tv->get_shape() != expected)
+        {
+            stringstream ss;
+            ss << what << " shape {" << join(tv->get_shape()) << "} does not match {"
+               << join(expected) << "}";
+            throw ngraph_error(ss.str());
+        }
+    };
+
+    vector<char> buffer;
+    vector<shared_ptr<runtime::TensorView>> specialized_inputs;
+    const op::ParameterVector& parameters = specialized->get_parameters();
+    if (inputs.size() != parameters.size() || outputs.size() != specialized->get_output_size())
+    {
+        throw ngraph_error("Call input or output count does not match the Function");
+    }
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (!specialized->is_batched_parameter(i))
+        {
+            specialized_inputs.push_back(inputs[i]);
+            continue;
+        }
+        check_shape(inputs[i], parameters[i]->get_shape(), "Input " + to_string(i));
+        if (batch_size == bucket_size)
+        {
+            specialized_inputs.push_back(inputs[i]);
+            continue;
+        }
+        auto padded =
+            create_tensor(parameters[i]->get_element_type(), parameters[i]->get_shape());
+        copy_batch_slices(inputs[i], 0, padded, 0, batch_size, axis, buffer);
+        copy_batch_slices(nullptr, 0, padded, batch_size, bucket_size - batch_size, axis, buffer);
+        specialized_inputs.push_back(padded);
+    }
+
+    vector<shared_ptr<runtime::TensorView>> specialized_outputs;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        const Shape& shape = specialized->get_output_shape(i);
+        check_shape(outputs[i], shape, "Output " + to_string(i));
+        specialized_outputs.push_back(
+            batch_size == bucket_size
+                ? outputs[i]
+                : create_tensor(specialized->get_output_element_type(i), shape));
+    }
+
+    bool rc = call(specialized, specialized_outputs, specialized_inputs);
+
+    if (batch_size != bucket_size)
+    {
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            auto result = specialized_outputs[i];
+            if (result->get_host_data_ptr() == nullptr)
+            {
+                // Reorder MKLDNN layouts before reading slices of the result
+                auto native = create_tensor(specialized->get_output_element_type(i),
+                                            result->get_shape());
+                result->read(native->get_host_data_ptr(),
+                             0,
+                             shape_size(result->get_shape()) *
+                                 specialized->get_output_element_type(i).size());
+                result = native;
+            }
+            auto descriptor = outputs[i]->get_descriptor();
+            descriptor->set_tensor_view_layout(
+                make_shared<runtime::cpu::LayoutDescriptor>(*descriptor));
+            copy_batch_slices(result, 0, outputs[i], 0, batch_size, axis, buffer);
+        }
+    }
     return rc;
 }
 
+bool runtime::cpu::CPU_Backend::has_independent_batch_slices(shared_ptr<Function> func)
+{
+    std::lock_guard<std::mutex> lock(m_specialization_mutex);
+    auto it = m_independent_batch_slices.find(func);
+    if (it == m_independent_batch_slices.end())
+    {
+        it = m_independent_batch_slices
+                 .insert({func, ngraph::has_independent_batch_slices(*func)})
+                 .first;
+    }
+    return it->second;
+}
+
+shared_ptr<Function> runtime::cpu::CPU_Backend::get_specialization(shared_ptr<Function> func,
+                                                                   size_t batch_size)
+{
+    shared_ptr<Function> specialized;
+    vector<shared_ptr<Function>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(m_specialization_mutex);
+        for (auto it = m_specializations.begin(); it != m_specializations.end(); ++it)
+        {
+            if (it->m_function == func && it->m_batch_size == batch_size)
+            {
+                m_specializations.splice(m_specializations.begin(), m_specializations, it);
+                return it->m_specialized_function;
+            }
+        }
+        specialized = specialize_batch(*func, batch_size);
+        m_specializations.push_front({func, batch_size, specialized});
+        while (m_specializations.size() > m_max_specializations)
+        {
+            evicted.push_back(m_specializations.back().m_specialized_function);
+            m_specializations.pop_back();
+        }
+    }
+    for (auto evicted_function : evicted)
+    {
+        remove_compiled_function(evicted_function);
+    }
+    return specialized;
+}
+
+void runtime::cpu::CPU_Backend::set_thread_pool(const shared_ptr<CPUThreadPool>& thread_pool)
+{
+    std::lock_guard<std::mutex> lock(m_function_map_mutex);
+    m_thread_pool = thread_pool;
+}
+
+shared_ptr<runtime::cpu::CPUThreadPool> runtime::cpu::CPU_Backend::get_thread_pool()
+{
+    std::lock_guard<std::mutex> lock(m_function_map_mutex);
+    return (m_thread_pool != nullptr ? m_thread_pool : CPUThreadPool::get_default());
+}
+
+vector<runtime::cpu::LayoutConversion>
+    runtime::cpu::CPU_Backend::get_layout_conversions(shared_ptr<Function> func)
+{
+    std::lock_guard<std::mutex> lock(m_function_map_mutex);
+    auto it = m_function_map.find(func);
+    if (it == m_function_map.end() || it->second->m_external_function == nullptr)
+    {
+        return {};
+    }
+    auto& external_function = it->second->m_external_function;
+    std::lock_guard<std::mutex> conversion_lock(external_function->m_layout_conversion_mutex);
+    return external_function->m_layout_conversions;
+}
+
+void runtime::cpu::CPU_Backend::enqueue_async_task(const function<void()>& task)
+{
+    if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        // Run asynchronous calls as TBB tasks so they share the scheduler and worker threads
+        // the flow graphs of the calls execute on. Tasks enqueued to an arena run even when
+        // no thread waits on it.
+        get_thread_pool()->get_task_arena().enqueue(task);
+    }
+    else
+    {
+        Backend::enqueue_async_task(task);
+    }
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    vector<shared_ptr<Function>> specializations;
+    {
+        std::lock_guard<std::mutex> lock(m_specialization_mutex);
+        m_independent_batch_slices.erase(func);
+        for (auto it = m_specializations.begin(); it != m_specializations.end();)
+        {
+            if (it->m_function == func)
+            {
+                specializations.push_back(it->m_specialized_function);
+                it = m_specializations.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    std::lock_guard<std::mutex> lock(m_function_map_mutex);
+    for (auto specialized : specializations)
+    {
+        m_function_map.erase(specialized);
+    }
     m_function_map.erase(func);
 }
 
@@ -113,41 +382,47 @@ void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> fu
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function != nullptr)
+    auto instance = get_instance(func);
+    std::lock_guard<std::mutex> lock(m_function_map_mutex);
+    if (instance->m_external_function != nullptr)
     {
         throw runtime_error("Performance data collection must be enabled prior to compiling.");
     }
-    instance.m_performance_counters_enabled = enable;
+    instance->m_performance_counters_enabled = enable;
 }
 
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
-    auto it = m_function_map.find(func);
-    if (it != m_function_map.end())
+    shared_ptr<CPU_ExternalFunction> external_function;
     {
-        const FunctionInstance& instance = it->second;
-        if (instance.m_external_function != nullptr)
+        std::lock_guard<std::mutex> lock(m_function_map_mutex);
+        auto it = m_function_map.find(func);
+        if (it != m_function_map.end())
         {
-            auto* engine = instance.m_external_function->m_execution_engine.get();
-            if (engine)
+            external_function = it->second->m_external_function;
+        }
+    }
+    if (external_function != nullptr)
+    {
+        auto* engine = external_function->m_execution_engine.get();
+        if (engine)
+        {
+            auto get_count = engine->find_function<size_t()>("get_debug_timer_count");
+            auto get_name = engine->find_function<const char*(size_t)>("get_debug_timer_name");
+            auto get_microseconds =
+                engine->find_function<size_t(size_t)>("get_debug_timer_microseconds");
+            auto get_call_count =
+                engine->find_function<size_t(size_t)>("get_debug_timer_call_count");
+
+            if (get_count && get_name && get_microseconds && get_call_count)
             {
-                auto get_count = engine->find_function<size_t()>("get_debug_timer_count");
-                auto get_name = engine->find_function<const char*(size_t)>("get_debug_timer_name");
-                auto get_microseconds =
-                    engine->find_function<size_t(size_t)>("get_debug_timer_microseconds");
-                auto get_call_count =
-                    engine->find_function<size_t(size_t)>("get_debug_timer_call_count");
-
-                if (get_count && get_name && get_microseconds && get_call_count)
+                size_t count = get_count();
+                for (size_t i = 0; i < count; i++)
                 {
-                    size_t count = get_count();
-                    for (size_t i = 0; i < count; i++)
-                    {
-                        rc.push_back({get_name(i), get_microseconds(i), get_call_count(i)});
-                    }
+                    string name = external_function->get_original_name(get_name(i));
+                    rc.push_back({name.c_str(), get_microseconds(i), get_call_count(i)});
                 }
             }
         }
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/runtime/backend.hpp"
 
@@ -29,10 +31,27 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPUThreadPool;
+            struct LayoutConversion;
 
+            /// Functions with a batch axis (Function::set_batch_axis) accept any extent of the
+            /// axis in call(). Calls run a specialization of the function for the next power of
+            /// two at or above the extent, with inputs padded by zeros, if the function computes
+            /// the slices of a batch independently of each other (see
+            /// ngraph::has_independent_batch_slices), and for the exact extent otherwise.
+            /// Specializations are compiled on first use and the NGRAPH_CPU_SPECIALIZATIONS
+            /// (default 8) most recently used are kept.
+            ///
+            /// Functions are compiled and called concurrently from several threads. Calls of
+            /// the same function only overlap when it runs through DEX without MKLDNN
+            /// primitives (CPU_ExternalFunction::is_reentrant()); the calls of any other
+            /// function, which includes most models with convolutions, are serialized.
             class CPU_Backend : public runtime::Backend
             {
             public:
+                CPU_Backend();
+                ~CPU_Backend() override;
+
                 std::shared_ptr<CPU_CallFrame>
                     make_call_frame(const std::shared_ptr<CPU_ExternalFunction>& external_function);
 
@@ -53,22 +72,67 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
 
+                /// \brief Set the threads used by functions compiled after this call. Backends
+                ///     share CPUThreadPool::get_default() unless given a pool of their own.
+                void set_thread_pool(const std::shared_ptr<CPUThreadPool>& thread_pool);
+                std::shared_ptr<CPUThreadPool> get_thread_pool();
+
+                /// \brief Reorders the CPULayout pass inserted into func when compiling it, with
+                ///     the time measured for them by calls made with NGRAPH_CPU_TRACING set.
+                std::vector<LayoutConversion>
+                    get_layout_conversions(std::shared_ptr<Function> func);
+
 #if !defined(NGRAPH_DEX_ONLY)
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
 #endif
 
+            protected:
+                void enqueue_async_task(const std::function<void()>& task) override;
+
             private:
+                bool call_with_batch(
+                    std::shared_ptr<Function> func,
+                    const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::TensorView>>& inputs,
+                    size_t batch_size);
+                std::shared_ptr<Function> get_specialization(std::shared_ptr<Function> func,
+                                                             size_t batch_size);
+                bool has_independent_batch_slices(std::shared_ptr<Function> func);
+
                 class FunctionInstance
                 {
                 public:
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    // Set once the function has been compiled
+                    std::once_flag m_compiled;
                 };
 
-                std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                std::shared_ptr<FunctionInstance> get_instance(std::shared_ptr<Function> func);
+                std::shared_ptr<FunctionInstance>
+                    get_compiled_instance(std::shared_ptr<Function> func);
+
+                std::map<std::shared_ptr<Function>, std::shared_ptr<FunctionInstance>>
+                    m_function_map;
+                std::shared_ptr<CPUThreadPool> m_thread_pool;
+                // Guards m_function_map; calls themselves run outside of the lock
+                mutable std::mutex m_function_map_mutex;
+
+                class Specialization
+                {
+                public:
+                    std::shared_ptr<Function> m_function;
+                    size_t m_batch_size;
+                    std::shared_ptr<Function> m_specialized_function;
+                };
+                // Most recently used first
+                std::list<Specialization> m_specializations;
+                size_t m_max_specializations;
+                std::map<std::shared_ptr<Function>, bool> m_independent_batch_slices;
+                std::mutex m_specialization_mutex;
             };
         }
     }
@@ -98,6 +98,7 @@
 #include "ngraph/runtime/cpu/kernel/tan.hpp"
 #include "ngraph/runtime/cpu/kernel/tanh.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -175,13 +176,19 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
 
                 auto element_count = out[0].get_size();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-
-                auto functor = [&, element_count](CPURuntimeContext* ctx) {
-                    runtime::cpu::kernel::logical_and(
-                        arg0_tensor, arg1_tensor, out0_tensor, element_count);
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                element_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::cpu::kernel::logical_and(ctx->buffer_data[arg0_buffer_index],
+                                                      ctx->buffer_data[arg1_buffer_index],
+                                                      ctx->buffer_data[out0_buffer_index],
+                                                      element_count);
                 };
                 functors.emplace_back(functor);
             }
@@ -192,13 +199,19 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
 
                 auto element_count = out[0].get_size();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-
-                auto functor = [&, element_count](CPURuntimeContext* ctx) {
-                    runtime::cpu::kernel::logical_or(
-                        arg0_tensor, arg1_tensor, out0_tensor, element_count);
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                element_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::cpu::kernel::logical_or(ctx->buffer_data[arg0_buffer_index],
+                                                     ctx->buffer_data[arg1_buffer_index],
+                                                     ctx->buffer_data[out0_buffer_index],
+                                                     element_count);
                 };
                 functors.emplace_back(functor);
             }
@@ -339,22 +352,22 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                vector<void**> dest;
+                vector<size_t> dest_indices;
                 for (auto& result : external_function->get_function()->get_results())
                 {
                     if (result.get() == node)
                     {
-                        dest.push_back(&external_function->get_tensor_data(
+                        dest_indices.push_back(external_function->get_buffer_index(
                             result->get_output_tensor(0).get_name()));
                     }
                 }
-                auto& src =
-                    external_function->get_tensor_data(node->get_output_tensor(0).get_name());
+                auto src_index =
+                    external_function->get_buffer_index(node->get_output_tensor(0).get_name());
                 auto size = node->get_output_tensor(0).size();
-                auto functor = [&, dest, src, size](CPURuntimeContext* ctx) {
-                    for (auto p : dest)
+                auto functor = [&, dest_indices, src_index, size](CPURuntimeContext* ctx) {
+                    for (auto p : dest_indices)
                     {
-                        memcpy(*p, src, size);
+                        memcpy(ctx->buffer_data[p], ctx->buffer_data[src_index], size);
                     }
                 };
                 functors.emplace_back(functor);
@@ -365,7 +378,9 @@ namespace ngraph
             BuildOpMap build_dispatcher{
                 {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
                 {TI(ngraph::runtime::cpu::op::ConvertLayout),
-                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>}};
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>},
+                {TI(ngraph::runtime::cpu::op::LoopKernel),
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::LoopKernel>}};
 
             REGISTER_OP_BUILDER(Constant);
             REGISTER_OP_BUILDER(Result);
@@ -15,11 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstdlib>
+#include <thread>
 
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 
 using namespace std;
@@ -29,13 +32,25 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
                                            EntryPoint compiled_function)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_max_contexts(std::max(std::thread::hardware_concurrency(), 1u))
 {
-    setup_runtime_context();
+    const auto env_concurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
+    if (env_concurrency != nullptr && std::atoi(env_concurrency) > 0)
+    {
+        m_max_contexts = std::atoi(env_concurrency);
+    }
+
+    auto ctx = setup_runtime_context();
+    m_contexts.push_back(ctx);
+    m_idle_contexts.push_back(ctx);
 }
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
-    cleanup_runtime_context();
+    for (auto ctx : m_contexts)
+    {
+        cleanup_runtime_context(ctx);
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::call(
@@ -47,6 +62,14 @@ void runtime::cpu::CPU_CallFrame::call(
 
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
 
+    std::unique_lock<std::mutex> call_lock(m_external_function->get_call_mutex(),
+                                           std::defer_lock);
+    if (!m_external_function->is_reentrant())
+    {
+        call_lock.lock();
+    }
+    CPURuntimeContext* ctx = acquire_runtime_context();
+
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
@@ -61,22 +84,67 @@ void runtime::cpu::CPU_CallFrame::call(
         outputs.push_back(tv->get_data_ptr());
     }
 
-    // Invoke compiled computation
-    if (!m_external_function->is_direct_execution())
+    try
     {
-        m_compiled_function(inputs.data(), outputs.data(), ctx);
+        CPUThreadPool::Scope thread_pool_scope(ctx->thread_pool);
+        auto run = [&]() {
+            // Invoke compiled computation
+            if (!m_external_function->is_direct_execution())
+            {
+                m_compiled_function(inputs.data(), outputs.data(), ctx);
+            }
+            else
+            {
+                m_external_function->get_executor()(ctx, inputs, outputs);
+            }
+        };
+        if (ctx->G != nullptr)
+        {
+            ctx->thread_pool->get_task_arena().execute(run);
+        }
+        else
+        {
+            run();
+        }
+
+        if (runtime::cpu::IsTracingEnabled())
+        {
+            GenerateTimeline(m_external_function->get_op_attrs(),
+                             ctx->op_durations,
+                             m_external_function->get_function_name() + ".timeline.json");
+            m_external_function->add_layout_conversion_times(ctx->op_durations);
+        }
     }
-    else
+    catch (...)
     {
-        m_external_function->get_executor()(ctx, inputs, outputs);
+        release_runtime_context(ctx);
+        throw;
     }
+    release_runtime_context(ctx);
+}
 
-    if (runtime::cpu::IsTracingEnabled())
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::acquire_runtime_context()
+{
+    std::unique_lock<std::mutex> lock(m_context_mutex);
+    if (m_idle_contexts.empty() && m_contexts.size() < m_max_contexts)
+    {
+        auto ctx = setup_runtime_context();
+        m_contexts.push_back(ctx);
+        return ctx;
+    }
+    m_context_available.wait(lock, [this]() { return !m_idle_contexts.empty(); });
+    auto ctx = m_idle_contexts.back();
+    m_idle_contexts.pop_back();
+    return ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::release_runtime_context(CPURuntimeContext* ctx)
+{
     {
-        GenerateTimeline(m_external_function->get_op_attrs(),
-                         ctx->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
+        std::lock_guard<std::mutex> lock(m_context_mutex);
+        m_idle_contexts.push_back(ctx);
     }
+    m_context_available.notify_one();
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -99,9 +167,9 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::setup_runtime_context()
 {
-    ctx = new CPURuntimeContext;
+    auto ctx = new CPURuntimeContext;
 
     ctx->op_durations = nullptr;
     if (runtime::cpu::IsTracingEnabled())
@@ -112,6 +180,11 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 
     ctx->first_iteration = true;
 
+    ctx->buffer_data = new void*[m_external_function->get_buffer_count()]();
+    ctx->buffer_stale = new bool[m_external_function->get_buffer_count()]();
+    ctx->pointer_scratch = new void*[m_external_function->get_pointer_scratch_size()]();
+    ctx->pending_predecessors = nullptr;
+
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
@@ -123,25 +196,29 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
     ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
 
+    ctx->G = nullptr;
+    ctx->thread_pool = m_external_function->get_thread_pool().get();
     if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
     {
-        ctx->G = new tbb::flow::graph;
-        const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
-        const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
-        ctx->c = new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
-        ctx->init = new tbb::task_scheduler_init(parallelism);
+        // Inter-op parallelism is bounded by the concurrency of the thread pool's arena
+        ctx->thread_pool->get_task_arena().execute([ctx]() { ctx->G = new tbb::flow::graph; });
     }
+    return ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context(CPURuntimeContext* ctx)
 {
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->buffer_data;
+    delete[] ctx->buffer_stale;
+    delete[] ctx->pointer_scratch;
+    delete[] ctx->pending_predecessors;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
     }
-    if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    if (ctx->G != nullptr)
     {
         // delete graph G and nodes in G
         ctx->G->wait_for_all();
@@ -155,8 +232,6 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         {
             delete node;
         }
-        delete ctx->c;
-        delete ctx->init;
     }
     delete ctx;
 }
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -49,19 +51,31 @@ namespace ngraph
                 /// \brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
+                /// Calls may be made concurrently from several threads; each call runs with its
+                /// own runtime context taken from a pool owned by the call frame.
                 void call(const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::TensorView>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
-                void setup_runtime_context();
-                void cleanup_runtime_context();
+                CPURuntimeContext* setup_runtime_context();
+                void cleanup_runtime_context(CPURuntimeContext* ctx);
 
             protected:
+                CPURuntimeContext* acquire_runtime_context();
+                void release_runtime_context(CPURuntimeContext* ctx);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
-                CPURuntimeContext* ctx;
+
+                // Runtime contexts are created on demand, one per concurrent call, up to
+                // m_max_contexts (NGRAPH_CPU_CONCURRENCY) and are reused by later calls
+                std::mutex m_context_mutex;
+                std::condition_variable m_context_available;
+                std::vector<CPURuntimeContext*> m_contexts;
+                std::vector<CPURuntimeContext*> m_idle_contexts;
+                size_t m_max_contexts;
             };
         }
     }
@@ -51,6 +51,7 @@
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/less.hpp"
 #include "ngraph/op/less_eq.hpp"
 #include "ngraph/op/log.hpp"
@@ -104,7 +105,6 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/dequantize.hpp"
-#include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -2724,7 +2724,25 @@ namespace ngraph
                 }
                 else
                 {
-                    throw ngraph_error("unsupported parameters for GroupConvolution");
+                    writer << "reference::group_convolution<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                               " << args[1].get_name() << ",\n";
+                    writer << "                               " << out[0].get_name() << ",\n";
+                    writer << "                               {" << join(arg0_shape) << "},\n";
+                    writer << "                               {" << join(arg1_shape) << "},\n";
+                    writer << "                               {" << join(result_shape) << "},\n";
+                    writer << "                               {"
+                           << join(convolution->get_window_movement_strides()) << "},\n";
+                    writer << "                               {"
+                           << join(convolution->get_window_dilation_strides()) << "},\n";
+                    writer << "                               {"
+                           << join(convolution->get_padding_below()) << "},\n";
+                    writer << "                               {"
+                           << join(convolution->get_padding_above()) << "},\n";
+                    writer << "                               {"
+                           << join(convolution->get_data_dilation_strides()) << "},\n";
+                    writer << "                               " << convolution->get_groups()
+                           << ");\n";
                 }
             }
 
@@ -4417,6 +4435,16 @@ namespace ngraph
                 return opname + "(" + join(args) + ")";
             }
 
+            static std::string emit_sigmoid(const std::vector<std::string>& args)
+            {
+                return "1 / (1 + std::exp(-" + args.at(0) + "))";
+            }
+
+            static std::string emit_identity(const std::vector<std::string>& args)
+            {
+                return args.at(0);
+            }
+
             static std::unordered_map<std::type_index,
                                       std::function<std::string(const std::vector<std::string>&)>>
                 initialize_inline_emitters()
@@ -4431,6 +4459,16 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
+                auto expe =
+                    std::bind(emit_function_call, std::string("std::exp"), std::placeholders::_1);
+                auto loge =
+                    std::bind(emit_function_call, std::string("std::log"), std::placeholders::_1);
+                auto sqrte =
+                    std::bind(emit_function_call, std::string("std::sqrt"), std::placeholders::_1);
+                auto tanhe =
+                    std::bind(emit_function_call, std::string("std::tanh"), std::placeholders::_1);
 
                 return std::unordered_map<
                     std::type_index,
@@ -4442,6 +4480,15 @@ namespace ngraph
                     {TI(ngraph::op::Add), adde},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Multiply), mule},
+                    {TI(ngraph::op::Divide), dive},
+                    {TI(ngraph::op::Exp), expe},
+                    {TI(ngraph::op::Log), loge},
+                    {TI(ngraph::op::Sqrt), sqrte},
+                    {TI(ngraph::op::Tanh), tanhe},
+                    {TI(ngraph::op::Sigmoid), emit_sigmoid},
+                    // only scalars are broadcast inside loop kernels
+                    {TI(ngraph::op::Broadcast), emit_identity},
                 };
             }
 
@@ -4478,7 +4525,9 @@ namespace ngraph
 
                 for (size_t i = 0; i < args.size(); i++)
                 {
-                    std::string sname = std::string(args[i].get_name()) + "[i]";
+                    // scalar inputs feed Broadcasts and are read in place
+                    std::string index = (args[i].get_size() == out[0].get_size() ? "[i]" : "[0]");
+                    std::string sname = std::string(args[i].get_name()) + index;
                     auto entry = std::make_pair(&clk->get_inputs().at(i).get_output(), sname);
                     loop_symbol_table.insert(entry);
                 }
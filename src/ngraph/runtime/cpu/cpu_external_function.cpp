@@ -14,9 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <cctype>
 #include <cstdlib>
+#include <exception>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -74,6 +80,7 @@
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/less.hpp"
 #include "ngraph/op/less_eq.hpp"
 #include "ngraph/op/log.hpp"
@@ -126,6 +133,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
@@ -135,6 +143,7 @@
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -144,7 +153,6 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/dequantize.hpp"
-#include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -159,6 +167,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -188,6 +197,8 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
 #else
     , m_direct_execution(true)
 #endif
+    , m_is_reentrant(false)
+    , m_thread_pool(CPUThreadPool::get_default())
 {
 }
 
@@ -195,6 +206,43 @@ runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
 {
 }
 
+void runtime::cpu::CPU_ExternalFunction::add_layout_conversion_times(const int64_t* op_durations)
+{
+    std::lock_guard<std::mutex> lock(m_layout_conversion_mutex);
+    if (!m_layout_conversion_slots_found)
+    {
+        for (size_t slot = 0; slot < m_op_attrs.size(); slot++)
+        {
+            const auto& outputs = m_op_attrs[slot].Outputs;
+            for (size_t i = 0; i < m_layout_conversions.size(); i++)
+            {
+                if (!outputs.empty() && outputs[0] == m_layout_conversions[i].Output)
+                {
+                    m_layout_conversion_slots.emplace_back(slot, i);
+                }
+            }
+        }
+        m_layout_conversion_slots_found = true;
+    }
+    for (const auto& slot : m_layout_conversion_slots)
+    {
+        m_layout_conversions[slot.second].Microseconds += op_durations[slot.first];
+        m_layout_conversions[slot.second].CallCount++;
+    }
+}
+
+// TODO (pruthvi): Fuse every LSTM cell by default after fixing the failing mxnet unit tests.
+// Until then only the cells a frontend marked as fusable are fused, unless
+// NGRAPH_CPU_RNN_FUSION is set.
+static void register_rnn_fusion_passes(ngraph::pass::Manager& pass_manager)
+{
+    bool marked_cells_only = std::getenv("NGRAPH_CPU_RNN_FUSION") == nullptr;
+    pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>(marked_cells_only);
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
+    pass_manager.register_pass<runtime::cpu::pass::MultiLayerRNNFusion>();
+}
+
 #if !defined(NGRAPH_DEX_ONLY)
 
 static const string s_output_dir = "cpu_codegen";
@@ -367,13 +415,43 @@ static void
     writer << "}\n";
 }
 
-void runtime::cpu::CPU_ExternalFunction::compile()
+static void emit_constant_data(codegen::CodeWriter& writer,
+                               const ngraph::op::Constant& constant,
+                               const string& name)
 {
-    if (m_is_compiled)
+    string type = constant.get_element_type().c_type_string();
+    size_t size = shape_size(constant.get_shape()) * constant.get_element_type().size();
+    const uint8_t* data = static_cast<const uint8_t*>(constant.get_data_ptr());
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+
+    writer << "alignas(" << alignment << ") static uint8_t " << name << "_data["
+           << max(size, size_t(1)) << "] =\n";
+    writer << "{\n";
+    writer.indent++;
+    stringstream line;
+    line << hex;
+    for (size_t i = 0; i < size; i++)
     {
-        return;
+        line << "0x" << static_cast<uint32_t>(data[i]) << ",";
+        if (i % 16 == 15 || i == size - 1)
+        {
+            writer << line.str() << "\n";
+            line.str("");
+        }
+        else
+        {
+            line << " ";
+        }
     }
+    writer.indent--;
+    writer << "};\n";
+    writer << "static " << type << "* " << name << " = reinterpret_cast<" << type << "*>(" << name
+           << "_data);\n";
+}
 
+string runtime::cpu::CPU_ExternalFunction::generate_code(bool standalone,
+                                                         string& pch_header_source)
+{
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
 
     ngraph::pass::Manager pass_manager;
@@ -383,12 +461,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     NodeVector nv_cwi;
     pass_manager.register_pass<ngraph::pass::LikeReplacement>();
     pass_manager.register_pass<ngraph::pass::NopElimination>();
-    // TODO (pruthvi): Enable all the disabeled RNN fusion graph pass after fixing
-    // failing mxnet unit tests.
-    // pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
-    // pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
-    pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
-    // pass_manager.register_pass<runtime::cpu::pass::MultiLayerRNNFusion>();
+    register_rnn_fusion_passes(pass_manager);
     // pass_manager.register_pass<runtime::cpu::pass::ConcatInputs>();
     pass_manager.register_pass<runtime::cpu::pass::CPUBatchFusion>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
@@ -408,7 +481,9 @@ void runtime::cpu::CPU_ExternalFunction::compile()
                          placeholders::_2);
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
         femitter, node_function_map, common_function_string);
+    pass_manager.register_pass<ngraph::pass::MemorySchedule>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
+    // Intermediates never share memory here, so offline planning would not shrink the pool
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
     pass_manager.run_passes(m_function);
 
@@ -418,6 +493,31 @@ void runtime::cpu::CPU_ExternalFunction::compile()
         function_ordered_ops.insert({current_function, current_function->get_ordered_ops()});
     }
 
+    // Default names end in a counter shared by the whole process. Number them again in
+    // emission order so that identical graphs generate identical canonical source.
+    m_canonical_names.clear();
+    m_original_names.clear();
+    size_t canonical_index = 0;
+    auto add_canonical_name = [&](const string& name) {
+        size_t separator = name.rfind('_');
+        if (separator == string::npos || separator == 0 || separator + 1 == name.size() ||
+            name.find_first_not_of("0123456789", separator + 1) != string::npos)
+        {
+            return;
+        }
+        string canonical_name = name.substr(0, separator + 1) + "c" + to_string(canonical_index++);
+        m_canonical_names.insert({name, canonical_name});
+        m_original_names.insert({canonical_name, name});
+    };
+    for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+    {
+        add_canonical_name(current_function->get_name());
+        for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+        {
+            add_canonical_name(node->get_name());
+        }
+    }
+
     codegen::CodeWriter writer;
 
     writer << "// Generated by the nGraph CPU backend\n";
@@ -425,7 +525,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     {
         writer << "#undef __TBB_PREVIEW_LIGHTWEIGHT_POLICY \n";
         writer << "#define __TBB_PREVIEW_LIGHTWEIGHT_POLICY 1\n";
-        writer << "#include <tbb/flow_graph.h>";
+        writer << "#include <tbb/flow_graph.h>\n";
+        writer << "#include \"ngraph/runtime/cpu/cpu_thread_pool.hpp\"";
     }
 
     writer +=
@@ -446,6 +547,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/group_convolution.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
@@ -480,14 +582,18 @@ using namespace ngraph::runtime;
     writer << "#include <mpi.h>\n\n";
 #endif
 
-    string pch_header_source = writer.get_code();
+    pch_header_source = writer.get_code();
 
     // The "dso_handle" symbol is required by __cxa_atexit()
     // which is enabled because the JIT uses it as the default mechanism
     // to register cleanup handlers. We use it, and not atexit(), because
-    // atexit() happens too late, when the JIT is no longer alive
+    // atexit() happens too late, when the JIT is no longer alive.
+    // A shared library gets it from the C runtime.
 
-    writer << "void *__dso_handle = 0;\n\n";
+    if (!standalone)
+    {
+        writer << "void *__dso_handle = 0;\n\n";
+    }
 
     if (m_emit_timing)
     {
@@ -543,7 +649,11 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant data is bound when the function is loaded rather than embedded as
+    // addresses so that the generated code does not depend on this process. Standalone
+    // code carries a copy of the data instead.
     writer << "// Declare all constants\n";
+    stringstream constant_bindings;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
@@ -551,16 +661,35 @@ using namespace ngraph::runtime;
             const ngraph::op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
             if (c)
             {
-                m_active_constants.push_back(node);
                 shared_ptr<descriptor::TensorView> tv = node->get_outputs()[0].get_tensor_view();
                 string type = tv->get_tensor().get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_tensor().get_name() << " = (("
-                       << type << "*)(" << c->get_data_ptr() << "));\n";
+                if (standalone)
+                {
+                    emit_constant_data(writer, *c, tv->get_tensor().get_name());
+                }
+                else
+                {
+                    writer << "static " << type << "* " << tv->get_tensor().get_name() << ";\n";
+                    constant_bindings << tv->get_tensor().get_name() << " = static_cast<" << type
+                                      << "*>(constants[" << m_active_constants.size() << "]);\n";
+                }
+                m_active_constants.push_back(node);
                 m_variable_name_map[tv->get_tensor().get_name()] = tv->get_tensor().get_name();
                 m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::CONSTANT;
             }
         }
     }
+    if (!standalone)
+    {
+        writer << "\nextern \"C\" void " << m_function_name
+               << "_bind_constants(void** constants)\n";
+        writer << "{\n";
+        writer.indent++;
+        writer << constant_bindings.str();
+        writer.indent--;
+        writer << "}\n";
+    }
+    writer << "\n";
 
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
@@ -768,6 +897,8 @@ using namespace ngraph::runtime;
                               "tbb::flow::lightweight>"
                               "(*(ctx->G), [&](const tbb::flow::continue_msg &msg)\n{\n";
                     writer.indent++;
+                    writer << "ngraph::runtime::cpu::CPUThreadPool::Scope "
+                              "thread_pool_scope(ctx->thread_pool);\n";
                 }
                 if (runtime::cpu::IsTracingEnabled() &&
                     current_function->get_name() == m_function_name)
@@ -947,26 +1078,6 @@ using namespace ngraph::runtime;
     out << code;
     out.close();
 
-    m_compiler.reset(new codegen::Compiler());
-    m_execution_engine.reset(new codegen::ExecutionEngine());
-
-    m_compiler->set_precompiled_header_source(pch_header_source);
-
-    auto codegen_module = m_compiler->compile(code);
-
-    if (codegen_module == nullptr)
-    {
-        throw runtime_error("function failed to compile");
-    }
-    m_execution_engine->add_module(codegen_module);
-    m_execution_engine->finalize();
-    m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(m_function_name);
-
-    if (m_compiled_function == nullptr)
-    {
-        throw runtime_error("could not find compiled function");
-    }
-
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1003,6 +1114,144 @@ using namespace ngraph::runtime;
         }
     }
 
+    return code;
+}
+
+string runtime::cpu::CPU_ExternalFunction::canonicalize_names(const string& code) const
+{
+    auto is_identifier = [](char c) { return isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+
+    // Names appear on their own and inside identifiers such as func_Add_12 and Add_12_0, so
+    // every '_' separated run of an identifier is matched, longest first
+    string canonical;
+    canonical.reserve(code.size());
+    size_t i = 0;
+    while (i < code.size())
+    {
+        if (!is_identifier(code[i]))
+        {
+            canonical.push_back(code[i++]);
+            continue;
+        }
+        size_t end = i;
+        while (end < code.size() && is_identifier(code[end]))
+        {
+            end++;
+        }
+        size_t position = i;
+        while (position < end)
+        {
+            bool replaced = false;
+            if (position == i || code[position - 1] == '_')
+            {
+                for (size_t last = end; last > position + 1 && !replaced; last--)
+                {
+                    if ((last != end && code[last] != '_') ||
+                        !isdigit(static_cast<unsigned char>(code[last - 1])))
+                    {
+                        continue;
+                    }
+                    auto it = m_canonical_names.find(code.substr(position, last - position));
+                    if (it != m_canonical_names.end())
+                    {
+                        canonical += it->second;
+                        position = last;
+                        replaced = true;
+                    }
+                }
+            }
+            if (!replaced)
+            {
+                canonical.push_back(code[position++]);
+            }
+        }
+        i = end;
+    }
+    return canonical;
+}
+
+const string&
+    runtime::cpu::CPU_ExternalFunction::get_original_name(const string& canonical_name) const
+{
+    auto it = m_original_names.find(canonical_name);
+    return it == m_original_names.end() ? canonical_name : it->second;
+}
+
+void runtime::cpu::CPU_ExternalFunction::compile()
+{
+    if (m_is_compiled)
+    {
+        return;
+    }
+
+    string pch_header_source;
+    string code = generate_code(false, pch_header_source);
+    string entry_point = m_function_name;
+
+    m_execution_engine.reset(new codegen::ExecutionEngine());
+
+    // Object code is cached by the generated source, so a graph that generates the same
+    // code on the same host and nGraph build skips the compiler entirely
+    bool loaded_object = false;
+    const char* cache_dir = std::getenv("NGRAPH_CPU_CODEGEN_CACHE_DIR");
+    if (cache_dir != nullptr)
+    {
+        code = canonicalize_names(code);
+        auto it = m_canonical_names.find(m_function_name);
+        if (it != m_canonical_names.end())
+        {
+            entry_point = it->second;
+        }
+
+        file_util::make_directory(cache_dir);
+        string object_path =
+            file_util::path_join(cache_dir, codegen::ExecutionEngine::get_object_key(code) + ".o");
+        loaded_object = m_execution_engine->load_object(object_path);
+        if (loaded_object)
+        {
+            NGRAPH_DEBUG << "CPU codegen: Loaded " << m_function_name << " from " << object_path;
+        }
+        else
+        {
+            m_execution_engine->save_object(object_path);
+        }
+    }
+
+    if (!loaded_object)
+    {
+        m_compiler.reset(new codegen::Compiler());
+        m_compiler->set_precompiled_header_source(pch_header_source);
+
+        auto codegen_module = m_compiler->compile(code);
+
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module);
+    }
+    m_execution_engine->finalize();
+    m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(entry_point);
+
+    if (m_compiled_function == nullptr)
+    {
+        throw runtime_error("could not find compiled function");
+    }
+
+    auto bind_constants =
+        m_execution_engine->find_function<void(void**)>(entry_point + "_bind_constants");
+    if (bind_constants == nullptr)
+    {
+        throw runtime_error("could not find compiled function");
+    }
+    vector<void*> constants;
+    for (auto& node : m_active_constants)
+    {
+        constants.push_back(const_cast<void*>(
+            static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+    }
+    bind_constants(constants.data());
+
     m_is_compiled = true;
     if (m_release_function)
     {
@@ -1010,6 +1259,17 @@ using namespace ngraph::runtime;
     }
 }
 
+string runtime::cpu::CPU_ExternalFunction::generate_standalone_code()
+{
+    string pch_header_source;
+    string code = generate_code(true, pch_header_source);
+    if (m_release_function)
+    {
+        release_function();
+    }
+    return code;
+}
+
 #endif
 
 bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
@@ -1138,12 +1398,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
     // in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
     pass_manager.register_pass<ngraph::pass::NopElimination>();
-    // TODO (pruthvi): Enable all the disabeled RNN fusion graph pass after fixing
-    // failing mxnet unit tests.
-    // pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
-    // pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    register_rnn_fusion_passes(pass_manager);
     // pass_manager.register_pass<runtime::cpu::pass::ConcatInputs>();
-    pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<runtime::cpu::pass::CPUBatchFusion>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
@@ -1151,10 +1407,17 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<runtime::cpu::pass::CPUCollapseDims>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
+    // Fuse the remaining (non-MKLDNN) elementwise chains into single-pass loop kernels
+    if (std::getenv("NGRAPH_CPU_DISABLE_LOOP_KERNELS") == nullptr)
+    {
+        pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    }
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
+    pass_manager.register_pass<ngraph::pass::MemorySchedule>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
+    // Intermediates never share memory here, so offline planning would not shrink the pool
     pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
     pass_manager.run_passes(m_function, false);
 
@@ -1196,16 +1459,23 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
     // Build executor
     // Intermediates
-    if (m_function->get_temporary_pool_size())
+    // Extent of each intermediate in the temporary pool, used to find ops that must not
+    // run concurrently because their tensors reuse the same memory
+    size_t pool_size = m_function->get_temporary_pool_size();
+    unordered_map<size_t, pair<size_t, size_t>> pool_extents;
+    if (pool_size)
     {
-        m_memory_buffer_sizes.push_back(m_function->get_temporary_pool_size());
+        m_memory_buffer_sizes.push_back(pool_size);
 
         for (auto& node : m_function->get_ordered_ops())
         {
             for (auto tensor : node->liveness_new_list)
             {
-                intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
+                intermediates_offsets.emplace_back(get_unaliased_buffer_index(tensor->get_name()),
                                                    tensor->get_pool_offset());
+                pool_extents[get_unaliased_buffer_index(tensor->get_name())] = make_pair(
+                    tensor->get_pool_offset(),
+                    tensor->get_pool_offset() + std::max<size_t>(tensor->size(), 1));
                 m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
             }
         }
@@ -1217,8 +1487,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
         if (node->is_constant())
         {
             auto tv = node->get_outputs()[0].get_tensor_view();
-            tensor_data[tv->get_tensor().get_name()] =
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr());
+            constant_tensor_data.emplace_back(
+                get_unaliased_buffer_index(tv->get_tensor().get_name()),
+                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
             m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::CONSTANT;
         }
     }
@@ -1230,9 +1501,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::TensorView> tv = param->get_output_tensor_view(i);
-            function_input_index.emplace_back(tensor_data[tv->get_tensor().get_name()],
-                                              arg_index,
-                                              tensor_stale[tv->get_tensor().get_name()]);
+            function_input_index.emplace_back(
+                get_unaliased_buffer_index(tv->get_tensor().get_name()), arg_index);
             m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::INPUT;
             propagate_in_place_input(
                 &param->get_outputs().at(i), tv->get_tensor().get_name(), true);
@@ -1245,7 +1515,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::TensorView> tv = op->get_output_tensor_view();
-        function_output_index.emplace_back(tensor_data[tv->get_tensor().get_name()], i);
+        function_output_index.emplace_back(get_unaliased_buffer_index(tv->get_tensor().get_name()),
+                                           i);
         m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::OUTPUT;
 
         //keep assigning different outputs to a result descriptor
@@ -1257,7 +1528,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             shared_ptr<descriptor::TensorView> itv =
                 res->get_inputs().at(0).get_output().get_tensor_view();
-            function_output_index.emplace_back(tensor_data[itv->get_tensor().get_name()], i);
+            function_output_index.emplace_back(
+                get_unaliased_buffer_index(itv->get_tensor().get_name()), i);
             m_tensor_roles[itv->get_tensor().get_name()] = CPUTensorRole::OUTPUT;
             tensor_alias[itv->get_tensor().get_name()] = tv->get_tensor().get_name();
             propagate_in_place_output(
@@ -1265,6 +1537,68 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
+    // Intermediates occupy their pool extent, other tensors own their buffer. Buffers are
+    // mapped past the end of the pool so that both can be compared as extents.
+    auto tensor_extent = [&](const string& name) {
+        size_t index = get_buffer_index(name);
+        auto it = pool_extents.find(index);
+        if (it != pool_extents.end())
+        {
+            return it->second;
+        }
+        return make_pair(pool_size + index, pool_size + index + 1);
+    };
+    // Disjoint pieces of the extents touched so far, keyed by their start, with the last op
+    // that wrote each piece and the ops that read it since
+    struct MemorySegment
+    {
+        size_t end;
+        size_t writer;
+        vector<size_t> readers;
+    };
+    const size_t no_writer = numeric_limits<size_t>::max();
+    map<size_t, MemorySegment> segments;
+    auto split_segment = [&](size_t position) {
+        auto it = segments.upper_bound(position);
+        if (it != segments.begin())
+        {
+            --it;
+            if (it->first < position && position < it->second.end)
+            {
+                MemorySegment tail = it->second;
+                it->second.end = position;
+                segments.emplace(position, move(tail));
+            }
+        }
+    };
+    // Adds segments for the memory in extent that has not been touched yet
+    auto add_segments = [&](const pair<size_t, size_t>& extent) {
+        split_segment(extent.first);
+        size_t position = extent.first;
+        auto it = segments.lower_bound(extent.first);
+        while (position < extent.second)
+        {
+            if (it == segments.end() || it->first > position)
+            {
+                size_t end = (it == segments.end() ? extent.second : min(it->first, extent.second));
+                it = segments.emplace_hint(it, position, MemorySegment{end, no_writer, {}});
+            }
+            position = it->second.end;
+            ++it;
+        }
+    };
+    auto covering_segments = [&](const pair<size_t, size_t>& extent) {
+        vector<map<size_t, MemorySegment>::iterator> covered;
+        for (auto it = segments.lower_bound(extent.first);
+             it != segments.end() && it->first < extent.second;
+             ++it)
+        {
+            covered.push_back(it);
+        }
+        return covered;
+    };
+
+    std::unordered_map<std::string, size_t> node_positions;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1305,30 +1639,23 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get());
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
-            if (tensor_alias.count(name))
-            {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
-            }
-            else
-            {
-                in_stale.emplace_back(tensor_stale[name]);
-            }
+            in_stale.emplace_back(get_buffer_index(name));
         }
         for (const auto& name : out_names)
         {
-            out_stale.emplace_back(tensor_stale[name]);
+            out_stale.emplace_back(get_unaliased_buffer_index(name));
         }
 
         function<bool(CPURuntimeContext*)> enable;
         if (disable_caching)
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
+                for (auto index : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->buffer_stale[index] = true;
                 }
                 return true;
             };
@@ -1337,24 +1664,122 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
                 bool en = false;
-                for (const auto& stale : in_stale)
+                for (auto index : in_stale)
                 {
-                    if (stale)
+                    if (ctx->buffer_stale[index])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (auto index : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->buffer_stale[index] = en;
                 }
                 return en;
             };
         }
 
+        set<size_t> predecessors;
+        for (auto arg : node->get_arguments())
+        {
+            if (!arg->is_parameter() && !arg->is_constant())
+            {
+                predecessors.insert(node_positions.at(arg->get_name()));
+            }
+        }
+        // Memory reuse and in-place ops make earlier ops that touch the memory this op
+        // writes, or that write the memory it reads, predecessors as well
+        size_t position = enables.size();
+        vector<pair<size_t, size_t>> reads, writes;
+        for (const auto& name : in_names)
+        {
+            reads.push_back(tensor_extent(name));
+        }
+        for (const auto& name : out_names)
+        {
+            writes.push_back(tensor_extent(name));
+        }
+        // Split the segments at every extent boundary first so that a collected segment
+        // cannot be split by a later extent of the same op
+        for (const auto& extents : {reads, writes})
+        {
+            for (const auto& extent : extents)
+            {
+                add_segments(extent);
+            }
+        }
+        for (const auto& extents : {reads, writes})
+        {
+            for (const auto& extent : extents)
+            {
+                split_segment(extent.first);
+                split_segment(extent.second);
+            }
+        }
+        vector<map<size_t, MemorySegment>::iterator> read_segments, write_segments;
+        for (const auto& extent : reads)
+        {
+            auto covered = covering_segments(extent);
+            read_segments.insert(read_segments.end(), covered.begin(), covered.end());
+        }
+        for (const auto& extent : writes)
+        {
+            auto covered = covering_segments(extent);
+            write_segments.insert(write_segments.end(), covered.begin(), covered.end());
+        }
+        for (auto segment : read_segments)
+        {
+            if (segment->second.writer != no_writer)
+            {
+                predecessors.insert(segment->second.writer);
+            }
+        }
+        for (auto segment : write_segments)
+        {
+            if (segment->second.writer != no_writer)
+            {
+                predecessors.insert(segment->second.writer);
+            }
+            predecessors.insert(segment->second.readers.begin(), segment->second.readers.end());
+        }
+        for (auto segment : read_segments)
+        {
+            segment->second.readers.push_back(position);
+        }
+        for (auto segment : write_segments)
+        {
+            segment->second.writer = position;
+            segment->second.readers.clear();
+        }
+        predecessors.erase(position);
+        node_positions[node->get_name()] = position;
+        m_flowgraph_predecessors.emplace_back(predecessors.begin(), predecessors.end());
+
         enables.emplace_back(make_pair(enable, functors.size() - functor_count));
-        enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
+    }
+
+    for (auto& functor : functors)
+    {
+        m_schedule_functors.push_back(&functor);
+    }
+    size_t functor_offset = 0;
+    for (const auto& p : enables)
+    {
+        m_schedule.push_back({&p.first, functor_offset, p.second, 0, {}});
+        functor_offset += p.second;
+    }
+    for (size_t i = 0; i < m_schedule.size(); i++)
+    {
+        m_schedule[i].predecessor_count = m_flowgraph_predecessors[i].size();
+        if (m_flowgraph_predecessors[i].empty())
+        {
+            m_schedule_roots.push_back(i);
+        }
+        for (auto predecessor : m_flowgraph_predecessors[i])
+        {
+            m_schedule[predecessor].successors.push_back(i);
+        }
     }
 
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
@@ -1363,21 +1788,26 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         if (ctx->first_iteration)
         {
-            for (auto& p : intermediates_offsets)
+            for (const auto& p : intermediates_offsets)
+            {
+                ctx->buffer_data[p.first] =
+                    static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+            }
+            for (const auto& p : constant_tensor_data)
             {
-                p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+                ctx->buffer_data[p.first] = p.second;
             }
         }
 
         for (const auto& p : function_input_index)
         {
-            get<0>(p).get() = inputs[get<1>(p)];
-            get<2>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->buffer_data[p.first] = inputs[p.second];
+            ctx->buffer_stale[p.first] = ctx->p_en[p.second];
         }
 
         for (const auto& p : function_output_index)
         {
-            p.first.get() = outputs[p.second];
+            ctx->buffer_data[p.first] = outputs[p.second];
         }
 
         auto functor = functors.begin();
@@ -1386,15 +1816,14 @@ void runtime::cpu::CPU_ExternalFunction::build()
             // Build the flow graph
             if (ctx->first_iteration)
             {
-                std::unordered_map<
-                    std::string,
+                std::vector<
                     tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>
-                    nodename_tbbnode_map;
+                    flowgraph_nodes;
                 tbb::flow::continue_node<tbb::flow::continue_msg,
                                          tbb::flow::lightweight>* flowgraph_node_start =
                     new tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>(
                         *(ctx->G), [&](const tbb::flow::continue_msg& msg) {});
-                auto it = enable_nodename_list.begin();
+                size_t profiler_offset = 0;
                 for (const auto& p : enables)
                 {
                     std::vector<std::function<void(CPURuntimeContext*)>> ftrs;
@@ -1404,14 +1833,20 @@ void runtime::cpu::CPU_ExternalFunction::build()
                         std::advance(functor, 1);
                     }
 
+                    // The flow graph outlives this call, so the node body must not refer to
+                    // any of the executor's locals
                     tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*
                         flowgraph_node = new tbb::flow::continue_node<tbb::flow::continue_msg,
                                                                       tbb::flow::lightweight>(
-                            *(ctx->G), [&, ftrs](const tbb::flow::continue_msg& msg) {
+                            *(ctx->G),
+                            [ctx, ftrs, p, profiler_offset](const tbb::flow::continue_msg& msg) {
+                                CPUThreadPool::Scope thread_pool_scope(ctx->thread_pool);
+                                size_t profiler_count = profiler_offset;
                                 if (p.first(ctx) || ctx->first_iteration)
                                 {
                                     for (size_t j = 0; j < p.second; j++)
                                     {
+                                        cpu::Timestamp start_ts;
                                         if (runtime::cpu::IsTracingEnabled())
                                         {
                                             start_ts = cpu::Clock::now();
@@ -1437,35 +1872,20 @@ void runtime::cpu::CPU_ExternalFunction::build()
                                     }
                                 }
                             });
-                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
-                    it++;
+                    flowgraph_nodes.push_back(flowgraph_node);
+                    profiler_offset += p.second;
                 }
 
-                traverse_nodes(
-                    m_function, [&flowgraph_node_start, &nodename_tbbnode_map](shared_ptr<Node> n) {
-                        if (!n->is_parameter() && !n->is_constant())
-                        {
-                            bool is_head = true;
-                            for (auto arg : n->get_arguments())
-                            {
-                                if (!arg->is_parameter() && !arg->is_constant())
-                                {
-                                    is_head = false;
-                                    tbb::flow::make_edge(*(nodename_tbbnode_map[arg->get_name()]),
-                                                         *(nodename_tbbnode_map[n->get_name()]));
-                                }
-                            }
-                            if (is_head)
-                            {
-                                tbb::flow::make_edge(*flowgraph_node_start,
-                                                     *(nodename_tbbnode_map[n->get_name()]));
-                            }
-                        }
-                    });
-
-                if (m_release_function)
+                for (size_t i = 0; i < flowgraph_nodes.size(); i++)
                 {
-                    release_function();
+                    if (m_flowgraph_predecessors[i].empty())
+                    {
+                        tbb::flow::make_edge(*flowgraph_node_start, *flowgraph_nodes[i]);
+                    }
+                    for (auto predecessor : m_flowgraph_predecessors[i])
+                    {
+                        tbb::flow::make_edge(*flowgraph_nodes[predecessor], *flowgraph_nodes[i]);
+                    }
                 }
             }
             // Execute the flow graph
@@ -1482,6 +1902,11 @@ void runtime::cpu::CPU_ExternalFunction::build()
                 throw;
             }
         }
+        else if (ctx->thread_pool->get_inter_op_pool() != nullptr && m_schedule.size() > 1)
+        {
+            execute_parallel(ctx);
+            profiler_count = static_cast<int>(m_schedule_functors.size());
+        }
         else
         {
             for (const auto& p : enables)
@@ -1527,29 +1952,191 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     };
 
+    m_is_reentrant = m_mkldnn_emitter->get_mkldnn_primitives().empty();
     m_is_built = true;
 
-    if (m_release_function && !m_use_tbb)
+    if (m_release_function)
     {
         release_function();
     }
 }
 
-void*& runtime::cpu::CPU_ExternalFunction::get_tensor_data(const std::string& name)
+namespace
+{
+    // One call of CPU_ExternalFunction::execute_parallel(). Lives on the calling thread's
+    // stack, which waits for every op to finish before returning.
+    class ParallelCall
+    {
+    public:
+        ParallelCall(runtime::cpu::CPURuntimeContext* ctx, size_t op_count)
+            : m_ctx(ctx)
+            , m_pool(ctx->thread_pool->get_inter_op_pool())
+            , m_done(op_count)
+            , m_failed(false)
+        {
+        }
+
+        template <typename F>
+        void run(size_t op, const F& execute_op)
+        {
+            // Continue with one of the ops this op enables on the same thread and hand the
+            // others to the pool, whose threads steal work from each other's queues
+            while (true)
+            {
+                if (!m_failed.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        runtime::cpu::CPUThreadPool::Scope thread_pool_scope(m_ctx->thread_pool);
+                        execute_op(op);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(m_error_mutex);
+                        if (!m_failed.exchange(true))
+                        {
+                            m_error = std::current_exception();
+                        }
+                    }
+                }
+                size_t next = op;
+                for (auto successor : execute_op.successors(op))
+                {
+                    if (m_ctx->pending_predecessors[successor].fetch_sub(1) == 1)
+                    {
+                        if (next == op)
+                        {
+                            next = successor;
+                        }
+                        else
+                        {
+                            schedule(successor, execute_op);
+                        }
+                    }
+                }
+                m_done.Notify();
+                if (next == op)
+                {
+                    return;
+                }
+                op = next;
+            }
+        }
+
+        template <typename F>
+        void schedule(size_t op, const F& execute_op)
+        {
+            m_pool->Schedule([this, op, &execute_op]() { run(op, execute_op); });
+        }
+
+        void wait()
+        {
+            m_done.Wait();
+            if (m_error)
+            {
+                std::rethrow_exception(m_error);
+            }
+        }
+
+    private:
+        runtime::cpu::CPURuntimeContext* m_ctx;
+        Eigen::ThreadPoolInterface* m_pool;
+        Eigen::Barrier m_done;
+        std::atomic<bool> m_failed;
+        std::mutex m_error_mutex;
+        std::exception_ptr m_error;
+    };
+}
+
+void runtime::cpu::CPU_ExternalFunction::execute_parallel(CPURuntimeContext* ctx)
+{
+    if (ctx->pending_predecessors == nullptr)
+    {
+        ctx->pending_predecessors = new std::atomic<size_t>[m_schedule.size()];
+    }
+    for (size_t i = 0; i < m_schedule.size(); i++)
+    {
+        ctx->pending_predecessors[i].store(m_schedule[i].predecessor_count,
+                                           std::memory_order_relaxed);
+    }
+
+    struct ExecuteOp
+    {
+        void operator()(size_t op) const
+        {
+            const ScheduledOp& s = schedule[op];
+            bool tracing = runtime::cpu::IsTracingEnabled();
+            if ((*s.enable)(ctx) || ctx->first_iteration)
+            {
+                for (size_t j = 0; j < s.functor_count; j++)
+                {
+                    cpu::Timestamp start_ts;
+                    if (tracing)
+                    {
+                        start_ts = cpu::Clock::now();
+                    }
+                    (*functors[s.functor_offset + j])(ctx);
+                    if (tracing)
+                    {
+                        ctx->op_durations[s.functor_offset + j] =
+                            (std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() -
+                                                                        start_ts))
+                                .count();
+                    }
+                }
+            }
+            else if (tracing)
+            {
+                for (size_t j = 0; j < s.functor_count; j++)
+                {
+                    ctx->op_durations[s.functor_offset + j] = 0;
+                }
+            }
+        }
+        const std::vector<size_t>& successors(size_t op) const
+        {
+            return schedule[op].successors;
+        }
+
+        CPURuntimeContext* ctx;
+        const std::vector<ScheduledOp>& schedule;
+        const std::vector<std::function<void(CPURuntimeContext*)>*>& functors;
+    } execute_op{ctx, m_schedule, m_schedule_functors};
+
+    ParallelCall call(ctx, m_schedule.size());
+    for (size_t i = 1; i < m_schedule_roots.size(); i++)
+    {
+        call.schedule(m_schedule_roots[i], execute_op);
+    }
+    call.run(m_schedule_roots[0], execute_op);
+    call.wait();
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
-    if (tensor_alias.count(name))
+    auto alias = tensor_alias.find(name);
+    if (alias != tensor_alias.end())
     {
-        return tensor_data[tensor_alias[name]];
+        return get_unaliased_buffer_index(alias->second);
     }
-    else
+    return get_unaliased_buffer_index(name);
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_unaliased_buffer_index(const std::string& name)
+{
+    auto it = m_buffer_indices.find(name);
+    if (it == m_buffer_indices.end())
     {
-        return tensor_data[name];
+        it = m_buffer_indices.emplace(name, m_buffer_indices.size()).first;
     }
+    return it->second;
 }
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_ExternalFunction::make_call_frame()
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
 #if !defined(NGRAPH_DEX_ONLY)
     if (!m_is_compiled && !m_direct_execution)
     {
@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -39,6 +40,7 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 
 namespace ngraph
@@ -77,6 +79,21 @@ namespace ngraph
                 }
             };
 
+            /// A reorder inserted by the CPULayout pass. Time and call count accumulate over the
+            /// calls made with NGRAPH_CPU_TRACING set.
+            struct LayoutConversion
+            {
+                std::string Name;
+                std::string Input;
+                std::string Output;
+                std::vector<std::string> Consumers;
+                std::string InputFormat;
+                std::string OutputFormat;
+                size_t Bytes = 0;
+                int64_t Microseconds = 0;
+                size_t CallCount = 0;
+            };
+
             class CPU_ExternalFunction : public std::enable_shared_from_this<CPU_ExternalFunction>
             {
                 friend class CPU_Backend;
@@ -107,6 +124,13 @@ namespace ngraph
                     return m_mkldnn_emitter;
                 }
 
+                std::vector<LayoutConversion>& get_layout_conversions()
+                {
+                    return m_layout_conversions;
+                }
+                /// \brief Adds the durations of the layout conversions traced by a call
+                void add_layout_conversion_times(const int64_t* op_durations);
+
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
@@ -116,8 +140,18 @@ namespace ngraph
                 {
                     return functors;
                 }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
-                void*& get_tensor_data(const std::string& name);
+                // Returns the slot of the named tensor in CPURuntimeContext::buffer_data,
+                // following in-place aliases to the tensor that owns the memory
+                size_t get_buffer_index(const std::string& name);
+                size_t get_buffer_count() const { return m_buffer_indices.size(); }
+                // Reserves count slots of CPURuntimeContext::pointer_scratch for an op that
+                // gathers a variable number of tensor pointers per call and returns the first
+                size_t reserve_pointer_scratch(size_t count)
+                {
+                    m_pointer_scratch_size += count;
+                    return m_pointer_scratch_size - count;
+                }
+                size_t get_pointer_scratch_size() const { return m_pointer_scratch_size; }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -129,12 +163,44 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+#if !defined(NGRAPH_DEX_ONLY)
+                /// \brief Runs the CPU passes and code generator without compiling the result.
+                ///
+                /// Constant data is embedded in the returned source so that it can be built
+                /// into a standalone shared library exporting the function's EntryPoint_t.
+                std::string generate_standalone_code();
+                /// \brief True if compile() loaded the function's object code from the
+                /// NGRAPH_CPU_CODEGEN_CACHE_DIR cache instead of running the compiler.
+                bool is_object_cached() const
+                {
+                    return m_execution_engine != nullptr && m_execution_engine->is_object_loaded();
+                }
+                /// \brief Maps a node or function name of the canonical source compiled for
+                /// the codegen cache back to the name in the graph.
+                const std::string& get_original_name(const std::string& canonical_name) const;
+#endif
+                // True if call frames may run several calls of this function concurrently.
+                // Codegen keeps its control flags in globals and MKLDNN primitives have
+                // their memory bound in place, so those functions serialize their calls.
+                bool is_reentrant() const { return m_is_reentrant; }
+                std::mutex& get_call_mutex() { return m_call_mutex; }
+                // Threads the function's kernels run on, shared with other functions
+                const std::shared_ptr<CPUThreadPool>& get_thread_pool() const
+                {
+                    return m_thread_pool;
+                }
+                void set_thread_pool(const std::shared_ptr<CPUThreadPool>& thread_pool)
+                {
+                    m_thread_pool = thread_pool;
+                }
+
             protected:
                 void build();
 
 #if !defined(NGRAPH_DEX_ONLY)
 
                 void compile();
+                std::string generate_code(bool standalone, std::string& pch_header_source);
 
 #endif
 
@@ -150,6 +216,10 @@ namespace ngraph
                                                std::string output_name,
                                                bool dex);
                 bool computes_result(Node* node);
+                size_t get_unaliased_buffer_index(const std::string& name);
+                // Runs the ops of a direct execution call on the thread pool's inter-op
+                // pool, each op as soon as all of its predecessors have finished
+                void execute_parallel(CPURuntimeContext* ctx);
 
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(codegen::CodeWriter& writer,
@@ -191,6 +261,12 @@ namespace ngraph
 
                 std::map<std::string, size_t> m_name_index_map;
 
+                // Node and function names carry global counters, so the source is keyed for
+                // the codegen cache after renaming them in the order they are emitted
+                std::unordered_map<std::string, std::string> m_canonical_names;
+                std::unordered_map<std::string, std::string> m_original_names;
+                std::string canonicalize_names(const std::string& code) const;
+
                 // Because we are directly accessing the constant data stored in the
                 // Constant ops we need to keep a list of shared_ptr to each Constant
                 // so they don't get freed before we are done with them
@@ -205,26 +281,49 @@ namespace ngraph
                 std::vector<OpAttributes> m_op_attrs;
 
                 std::unique_ptr<MKLDNNEmitter> m_mkldnn_emitter;
+                std::vector<LayoutConversion> m_layout_conversions;
+                // Profiler slot of each layout conversion, found on the first traced call
+                std::vector<std::pair<size_t, size_t>> m_layout_conversion_slots;
+                bool m_layout_conversion_slots_found = false;
+                std::mutex m_layout_conversion_mutex;
 
                 std::string m_function_name;
 
                 std::list<std::function<void(CPURuntimeContext*)>> functors;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, size_t>> enables;
-                std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
-                    enable_nodename_list;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, bool> tensor_stale;
+                std::unordered_map<std::string, size_t> m_buffer_indices;
+                size_t m_pointer_scratch_size = 0;
                 std::unordered_map<std::string, std::string> tensor_alias;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> intermediates_offsets;
-                std::list<
-                    std::tuple<std::reference_wrapper<void*>, size_t, std::reference_wrapper<bool>>>
-                    function_input_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> function_output_index;
+                std::list<std::pair<size_t, size_t>> intermediates_offsets;
+                std::list<std::pair<size_t, void*>> constant_tensor_data;
+                std::list<std::pair<size_t, size_t>> function_input_index;
+                std::list<std::pair<size_t, size_t>> function_output_index;
+                // Flow graph edges precomputed at build time so the function can be
+                // released before any context builds its TBB graph. Besides data edges they
+                // order ops whose tensors share memory in the temporary pool.
+                std::vector<std::vector<size_t>> m_flowgraph_predecessors;
+                struct ScheduledOp
+                {
+                    const std::function<bool(CPURuntimeContext*)>* enable;
+                    // Position of the op's first functor, also its first profiler slot
+                    size_t functor_offset;
+                    size_t functor_count;
+                    size_t predecessor_count;
+                    std::vector<size_t> successors;
+                };
+                // Static schedule of execute_parallel(), in the order of enables
+                std::vector<ScheduledOp> m_schedule;
+                std::vector<std::function<void(CPURuntimeContext*)>*> m_schedule_functors;
+                std::vector<size_t> m_schedule_roots;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 bool m_direct_execution;
+                bool m_is_reentrant;
+                std::mutex m_mutex;
+                std::mutex m_call_mutex;
+                std::shared_ptr<CPUThreadPool> m_thread_pool;
             };
         }
     }
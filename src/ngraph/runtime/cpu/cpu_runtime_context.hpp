@@ -16,13 +16,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 
-#define TBB_PREVIEW_GLOBAL_CONTROL 1
 #include <tbb/flow_graph.h>
-#include <tbb/global_control.h>
-#include <tbb/task_scheduler_init.h>
 
 namespace mkldnn
 {
@@ -34,6 +32,10 @@ namespace ngraph
     namespace runtime
     {
         class AlignedBuffer;
+        namespace cpu
+        {
+            class CPUThreadPool;
+        }
     }
 }
 
@@ -57,8 +59,16 @@ namespace ngraph
                 std::vector<AlignedBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
                 tbb::flow::graph* G;
-                tbb::global_control* c;
-                tbb::task_scheduler_init* init;
+                CPUThreadPool* thread_pool;
+                // Per-context tensor pointer table and cached-result flags used by
+                // direct execution, indexed by CPU_ExternalFunction::get_buffer_index()
+                void** buffer_data;
+                bool* buffer_stale;
+                // Per-context pointer arrays of ops taking a variable number of tensors,
+                // sliced by CPU_ExternalFunction::reserve_pointer_scratch()
+                void** pointer_scratch;
+                // Unfinished predecessors of each op while the inter-op executor runs
+                std::atomic<size_t>* pending_predecessors;
             };
             }
         }
@@ -44,6 +44,7 @@ namespace ngraph
 
                 char* get_data_ptr();
                 const char* get_data_ptr() const;
+                void* get_host_data_ptr() override;
 
                 size_t get_size() const;
                 const element::Type& get_element_type() const;
@@ -66,6 +67,8 @@ namespace ngraph
                 CPUTensorView(const CPUTensorView&) = delete;
                 CPUTensorView(CPUTensorView&&) = delete;
                 CPUTensorView& operator=(const CPUTensorView&) = delete;
+                // True if the data is in an MKLDNN layout other than the row-major one
+                bool needs_layout_conversion() const;
 
                 char* buffer;
                 char* aligned_buffer;
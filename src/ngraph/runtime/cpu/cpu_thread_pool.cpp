@@ -0,0 +1,293 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// OpenMP runtime used by MKLDNN, provided by libiomp5
+extern "C" {
+int omp_get_max_threads();
+void omp_set_num_threads(int num_threads);
+}
+
+static thread_local runtime::cpu::CPUThreadPool* t_current_pool = nullptr;
+
+// Parse a sysfs cpu list such as "0-3,8-11"
+static vector<size_t> parse_cpu_list(const string& list)
+{
+    vector<size_t> cpus;
+    stringstream ss(list);
+    string range;
+    while (getline(ss, range, ','))
+    {
+        if (range.empty() || range == "\n")
+        {
+            continue;
+        }
+        size_t dash = range.find('-');
+        size_t first = stoul(range.substr(0, dash));
+        size_t last = (dash == string::npos ? first : stoul(range.substr(dash + 1)));
+        for (size_t cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+static vector<size_t> read_process_cores()
+{
+    vector<size_t> cores;
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+    {
+        for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &mask))
+            {
+                cores.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cores.empty())
+    {
+        for (size_t cpu = 0; cpu < std::max(thread::hardware_concurrency(), 1u); cpu++)
+        {
+            cores.push_back(cpu);
+        }
+    }
+    return cores;
+}
+
+// Cores the process may run on, read once since threads bound to a pool no longer report them
+static const vector<size_t>& get_process_cores()
+{
+    static const vector<size_t> cores = read_process_cores();
+    return cores;
+}
+
+// Read while the library loads, before any thread is bound to a pool's cores
+static const vector<size_t>& s_process_cores = get_process_cores();
+
+static vector<size_t> get_numa_node_cores(int node)
+{
+    ifstream cpulist("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+    string list;
+    if (!cpulist || !getline(cpulist, list))
+    {
+        throw ngraph_error("Unable to read the cores of NUMA node " + to_string(node));
+    }
+    return parse_cpu_list(list);
+}
+
+static void bind_current_thread(const vector<size_t>& cores)
+{
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (auto core : cores)
+    {
+        CPU_SET(core, &mask);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) != 0)
+    {
+        NGRAPH_DEBUG << "Unable to bind thread to cores " << join(cores);
+    }
+#endif
+}
+
+namespace
+{
+    // Starts Eigen pool threads bound to consecutive cores of the pool
+    struct PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+    {
+        PinnedThreadEnvironment(const vector<size_t>& cores)
+            : m_cores(cores)
+            , m_next_core(0)
+        {
+        }
+
+        EnvThread* CreateThread(function<void()> f)
+        {
+            size_t core = m_cores[m_next_core++ % m_cores.size()];
+            return new EnvThread([core, f]() {
+                bind_current_thread({core});
+                f();
+            });
+        }
+
+        vector<size_t> m_cores;
+        size_t m_next_core;
+    };
+}
+
+static unique_ptr<Eigen::ThreadPoolInterface>
+    create_eigen_pool(int num_threads, bool pin_threads, const vector<size_t>& cores)
+{
+    if (pin_threads)
+    {
+        return unique_ptr<Eigen::ThreadPoolInterface>(
+            new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                num_threads, PinnedThreadEnvironment(cores)));
+    }
+    return unique_ptr<Eigen::ThreadPoolInterface>(new Eigen::ThreadPool(num_threads));
+}
+
+runtime::cpu::CPUThreadPool::Config runtime::cpu::CPUThreadPool::Config::from_environment()
+{
+    Config config;
+
+    const auto omp_num_threads = std::getenv("OMP_NUM_THREADS");
+    const auto ngraph_intra_op_parallelism = std::getenv("NGRAPH_INTRA_OP_PARALLELISM");
+    int count = 0;
+    if (omp_num_threads && (count = std::atoi(omp_num_threads)) > 0)
+    {
+        config.intra_op_threads = count;
+    }
+    else if (ngraph_intra_op_parallelism &&
+             (count = std::atoi(ngraph_intra_op_parallelism)) > 0)
+    {
+        config.intra_op_threads = count;
+    }
+
+    const auto ngraph_inter_op_parallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
+    if (ngraph_inter_op_parallelism && (count = std::atoi(ngraph_inter_op_parallelism)) > 0)
+    {
+        config.inter_op_threads = count;
+    }
+    return config;
+}
+
+runtime::cpu::CPUThreadPool::Scope::Scope(CPUThreadPool* pool)
+    : m_previous(t_current_pool)
+    , m_previous_omp_threads(omp_get_max_threads())
+{
+    t_current_pool = pool;
+    omp_set_num_threads(static_cast<int>(get_current().get_config().intra_op_threads));
+}
+
+runtime::cpu::CPUThreadPool::Scope::~Scope()
+{
+    t_current_pool = m_previous;
+    omp_set_num_threads(m_previous_omp_threads);
+}
+
+runtime::cpu::CPUThreadPool::ArenaObserver::ArenaObserver(CPUThreadPool& pool)
+    : tbb::task_scheduler_observer(pool.m_task_arena)
+    , m_pool(pool)
+{
+    observe(true);
+}
+
+void runtime::cpu::CPUThreadPool::ArenaObserver::on_scheduler_entry(bool is_worker)
+{
+    if (is_worker)
+    {
+        bind_current_thread(m_pool.m_cores);
+    }
+}
+
+void runtime::cpu::CPUThreadPool::ArenaObserver::on_scheduler_exit(bool is_worker)
+{
+    if (is_worker)
+    {
+        // TBB workers are shared by all arenas of the process
+        bind_current_thread(s_process_cores);
+    }
+}
+
+runtime::cpu::CPUThreadPool::CPUThreadPool(const Config& config)
+    : m_config(config)
+{
+    m_cores = m_config.cores;
+    if (m_cores.empty())
+    {
+        m_cores =
+            (m_config.numa_node < 0 ? get_process_cores() : get_numa_node_cores(m_config.numa_node));
+    }
+    else if (m_config.numa_node >= 0)
+    {
+        throw ngraph_error("CPU thread pool cores and NUMA node are mutually exclusive");
+    }
+
+    if (m_config.intra_op_threads == 0)
+    {
+        // Leave hyperthreads idle by default
+        m_config.intra_op_threads = std::max<size_t>(m_cores.size() / 2, 1);
+    }
+    if (m_config.inter_op_threads == 0)
+    {
+        m_config.inter_op_threads = 1;
+    }
+
+    int intra_op_threads = static_cast<int>(m_config.intra_op_threads);
+    m_eigen_pool = create_eigen_pool(intra_op_threads, m_config.pin_threads, m_cores);
+    m_eigen_device.reset(new Eigen::ThreadPoolDevice(m_eigen_pool.get(), intra_op_threads));
+    if (m_config.inter_op_threads > 1)
+    {
+        // Kernels wait on the intra-op pool, so ops must not be scheduled on it as well
+        m_inter_op_pool = create_eigen_pool(
+            static_cast<int>(m_config.inter_op_threads), m_config.pin_threads, m_cores);
+    }
+
+    m_task_arena.initialize(static_cast<int>(m_config.inter_op_threads));
+    if (m_config.pin_threads)
+    {
+        m_arena_observer.reset(new ArenaObserver(*this));
+    }
+}
+
+runtime::cpu::CPUThreadPool::~CPUThreadPool()
+{
+    if (m_arena_observer)
+    {
+        m_arena_observer->observe(false);
+    }
+    m_task_arena.terminate();
+}
+
+const shared_ptr<runtime::cpu::CPUThreadPool>& runtime::cpu::CPUThreadPool::get_default()
+{
+    static shared_ptr<CPUThreadPool> s_default_pool =
+        make_shared<CPUThreadPool>(Config::from_environment());
+    return s_default_pool;
+}
+
+runtime::cpu::CPUThreadPool& runtime::cpu::CPUThreadPool::get_current()
+{
+    return (t_current_pool != nullptr ? *t_current_pool : *get_default());
+}
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#define TBB_PREVIEW_LOCAL_OBSERVER 1
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+
+namespace Eigen
+{
+    class ThreadPoolInterface;
+    struct ThreadPoolDevice;
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Threads shared by the Eigen kernels, the TBB flow graph and MKLDNN
+            ///     primitives of the functions a CPU backend executes.
+            ///
+            /// Intra-op parallelism runs on an Eigen thread pool and sets the OpenMP thread
+            /// count MKLDNN uses. Inter-op parallelism runs on a second Eigen thread pool for
+            /// direct execution and in a TBB task arena for TBB flow graphs. Backends
+            /// serving co-located models can be given pools on disjoint cores so they do not
+            /// oversubscribe the machine.
+            class CPUThreadPool
+            {
+            public:
+                struct Config
+                {
+                    /// Number of intra-op threads, 0 selects the default
+                    size_t intra_op_threads = 0;
+                    /// Number of inter-op threads, 0 selects the default
+                    size_t inter_op_threads = 0;
+                    /// Bind each thread of the pool to one core of the pool
+                    bool pin_threads = false;
+                    /// Restrict the pool to the cores of a NUMA node, -1 for any node
+                    int numa_node = -1;
+                    /// Cores the pool may use, all cores available to the process if empty
+                    std::vector<size_t> cores;
+
+                    /// Configuration from OMP_NUM_THREADS, NGRAPH_INTRA_OP_PARALLELISM and
+                    /// NGRAPH_INTER_OP_PARALLELISM
+                    static Config from_environment();
+                };
+
+                /// Makes a pool the calling thread executes for until the scope ends
+                class Scope
+                {
+                public:
+                    Scope(CPUThreadPool* pool);
+                    ~Scope();
+
+                private:
+                    Scope(const Scope&) = delete;
+                    Scope& operator=(const Scope&) = delete;
+
+                    CPUThreadPool* m_previous;
+                    int m_previous_omp_threads;
+                };
+
+                CPUThreadPool(const Config& config);
+                ~CPUThreadPool();
+
+                const Config& get_config() const { return m_config; }
+                const std::vector<size_t>& get_cores() const { return m_cores; }
+                Eigen::ThreadPoolDevice& get_eigen_device() { return *m_eigen_device; }
+                tbb::task_arena& get_task_arena() { return m_task_arena; }
+                /// Work-stealing pool that runs independent ops of a direct execution call
+                /// concurrently, nullptr if the pool has a single inter-op thread
+                Eigen::ThreadPoolInterface* get_inter_op_pool() { return m_inter_op_pool.get(); }
+                /// Pool configured from the environment, used unless a backend is given one
+                static const std::shared_ptr<CPUThreadPool>& get_default();
+                /// Pool of the innermost Scope on the calling thread, or the default pool
+                static CPUThreadPool& get_current();
+
+            private:
+                CPUThreadPool(const CPUThreadPool&) = delete;
+                CPUThreadPool& operator=(const CPUThreadPool&) = delete;
+
+                // Binds TBB workers to the pool's cores while they work in its arena
+                class ArenaObserver : public tbb::task_scheduler_observer
+                {
+                public:
+                    ArenaObserver(CPUThreadPool& pool);
+                    void on_scheduler_entry(bool is_worker) override;
+                    void on_scheduler_exit(bool is_worker) override;
+
+                private:
+                    CPUThreadPool& m_pool;
+                };
+
+                Config m_config;
+                std::vector<size_t> m_cores;
+                std::unique_ptr<Eigen::ThreadPoolInterface> m_eigen_pool;
+                std::unique_ptr<Eigen::ThreadPoolDevice> m_eigen_device;
+                std::unique_ptr<Eigen::ThreadPoolInterface> m_inter_op_pool;
+                tbb::task_arena m_task_arena;
+                std::unique_ptr<ArenaObserver> m_arena_observer;
+            };
+        }
+    }
+}
@@ -15,7 +15,6 @@
 //*****************************************************************************
 
 #pragma once
-#include <functional>
 #include <iostream>
 #include <vector>
 
@@ -34,10 +33,10 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType, int Rank>
-                void concat(std::vector<std::reference_wrapper<void*>> inputs,
-                            std::vector<Shape> input_shapes,
+                void concat(void* const* inputs,
+                            const std::vector<Shape>& input_shapes,
                             void* output,
-                            Shape output_shape,
+                            const Shape& output_shape,
                             size_t axis)
                 {
                     Eigen::array<Eigen::Index, Rank> out_dims;
@@ -59,8 +58,8 @@ namespace ngraph
                         }
 
                         Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
-                            static_cast<ElementType*>(inputs[i].get()), in_dims);
-                        out.slice(concat_pos, in_dims).device(eigen::global_thread_pool_device) =
+                            static_cast<ElementType*>(inputs[i]), in_dims);
+                        out.slice(concat_pos, in_dims).device(eigen::get_thread_pool_device()) =
                             in;
                         concat_pos[axis] += in_dims[axis];
                     }
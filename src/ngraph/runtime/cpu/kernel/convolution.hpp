@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/group_convolution.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -66,6 +67,35 @@ namespace ngraph
                                                         output_channel_axis_result,
                                                         rotate_filter);
                 }
+
+                template <typename ElementType>
+                void group_convolution(void* input0,
+                                       void* input1,
+                                       void* output,
+                                       const Shape& arg0_shape,
+                                       const Shape& arg1_shape,
+                                       const Shape& result_shape,
+                                       const Strides& window_movement_strides,
+                                       const Strides& window_dilation_strides,
+                                       const CoordinateDiff& padding_below,
+                                       const CoordinateDiff& padding_above,
+                                       const Strides& data_dilation_strides,
+                                       size_t groups)
+                {
+                    reference::group_convolution<ElementType>(
+                        static_cast<const ElementType*>(input0),
+                        static_cast<const ElementType*>(input1),
+                        static_cast<ElementType*>(output),
+                        arg0_shape,
+                        arg1_shape,
+                        result_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        groups);
+                }
             }
         }
     }
@@ -77,7 +77,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Input1Rank, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in1_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0.contract(in1, dot_dims);
+                    out.device(eigen::get_thread_pool_device()) = in0.contract(in1, dot_dims);
                 }
 
                 template <typename ElementType>
@@ -95,7 +95,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in1_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0[0] * in1;
+                    out.device(eigen::get_thread_pool_device()) = in0[0] * in1;
                 }
 
                 template <typename ElementType>
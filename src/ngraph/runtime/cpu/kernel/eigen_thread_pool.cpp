@@ -14,9 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <thread>
-
 #include "eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 
 namespace ngraph
 {
@@ -26,32 +25,10 @@ namespace ngraph
         {
             namespace eigen
             {
-                static int GetNumCores()
+                Eigen::ThreadPoolDevice& get_thread_pool_device()
                 {
-                    const auto omp_num_threads = std::getenv("OMP_NUM_THREADS");
-                    const auto ngraph_intra_op_parallelism =
-                        std::getenv("NGRAPH_INTRA_OP_PARALLELISM");
-                    int count = 0;
-
-                    if (omp_num_threads && (count = std::atoi(omp_num_threads)))
-                    {
-                        return count;
-                    }
-                    else if (ngraph_intra_op_parallelism &&
-                             (count == std::atoi(ngraph_intra_op_parallelism)))
-                    {
-                        return count;
-                    }
-                    else
-                    {
-                        count = std::thread::hardware_concurrency() >> 1;
-                    }
-                    return count ? count : 1;
+                    return CPUThreadPool::get_current().get_eigen_device();
                 }
-
-                Eigen::ThreadPool global_thread_pool(GetNumCores());
-                Eigen::ThreadPoolDevice global_thread_pool_device(&global_thread_pool,
-                                                                  global_thread_pool.NumThreads());
             }
         }
     }
@@ -27,8 +27,8 @@ namespace ngraph
         {
             namespace eigen
             {
-                extern Eigen::ThreadPool global_thread_pool;
-                extern Eigen::ThreadPoolDevice global_thread_pool_device;
+                // Device of the CPUThreadPool the calling thread executes for
+                Eigen::ThreadPoolDevice& get_thread_pool_device();
             }
         }
     }
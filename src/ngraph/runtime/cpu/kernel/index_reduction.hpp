@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#define EIGEN_USE_THREADS
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Index along `axis` of the first maximum (ComputeMax) or minimum of every slice,
+                // with the semantics of reference::argmax/argmin: an element replaces the current
+                // winner only if it compares strictly better. Slices run in parallel.
+                template <typename ElementType, typename IndexType, bool ComputeMax>
+                void index_reduction(void* input, void* output, const Shape& in_shape, size_t axis)
+                {
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    IndexType* out = static_cast<IndexType*>(output);
+                    auto better = [](ElementType a, ElementType b) {
+                        return (ComputeMax ? a > b : a < b);
+                    };
+
+                    size_t outer = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= in_shape[i];
+                    }
+                    size_t extent = in_shape.at(axis);
+                    size_t inner = 1;
+                    for (size_t i = axis + 1; i < in_shape.size(); i++)
+                    {
+                        inner *= in_shape[i];
+                    }
+                    if (outer * extent * inner == 0)
+                    {
+                        return;
+                    }
+
+                    if (inner == 1)
+                    {
+                        // Reduction along the innermost axis: find the best value of a row with
+                        // a vectorized reduction, then its first position.
+                        auto reduce_rows = [=](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index o = first; o < last; o++)
+                            {
+                                const ElementType* row = in + o * extent;
+                                Eigen::Map<const Eigen::Array<ElementType, Eigen::Dynamic, 1>>
+                                    values(row, extent);
+                                size_t index;
+                                if (std::is_floating_point<ElementType>::value && values.hasNaN())
+                                {
+                                    // The vectorized reduction may stop at a NaN, which never
+                                    // wins unless it comes first
+                                    index = 0;
+                                    for (size_t j = 1; j < extent; j++)
+                                    {
+                                        if (better(row[j], row[index]))
+                                        {
+                                            index = j;
+                                        }
+                                    }
+                                }
+                                else
+                                {
+                                    ElementType best =
+                                        (ComputeMax ? values.maxCoeff() : values.minCoeff());
+                                    index = std::find(row, row + extent, best) - row;
+                                }
+                                out[o] = static_cast<IndexType>(index);
+                            }
+                        };
+                        eigen::get_thread_pool_device().parallelFor(
+                            outer,
+                            Eigen::TensorOpCost(extent * sizeof(ElementType),
+                                                sizeof(IndexType),
+                                                extent),
+                            reduce_rows);
+                        return;
+                    }
+
+                    // Otherwise reduce blocks of the contiguous inner elements together, keeping
+                    // the best values of a block in a buffer so the inner loop vectorizes.
+                    const size_t block_size = 256;
+                    size_t blocks_per_slice = (inner + block_size - 1) / block_size;
+                    auto reduce_blocks = [=](Eigen::Index first, Eigen::Index last) {
+                        ElementType best[block_size];
+                        for (Eigen::Index b = first; b < last; b++)
+                        {
+                            size_t o = b / blocks_per_slice;
+                            size_t begin = (b % blocks_per_slice) * block_size;
+                            size_t count = std::min(block_size, inner - begin);
+                            const ElementType* slice = in + o * extent * inner + begin;
+                            IndexType* result = out + o * inner + begin;
+                            std::copy(slice, slice + count, best);
+                            std::fill(result, result + count, IndexType(0));
+                            for (size_t j = 1; j < extent; j++)
+                            {
+                                const ElementType* row = slice + j * inner;
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    bool is_better = better(row[i], best[i]);
+                                    best[i] = (is_better ? row[i] : best[i]);
+                                    result[i] = (is_better ? static_cast<IndexType>(j) : result[i]);
+                                }
+                            }
+                        }
+                    };
+                    eigen::get_thread_pool_device().parallelFor(
+                        outer * blocks_per_slice,
+                        Eigen::TensorOpCost(extent * block_size * sizeof(ElementType),
+                                            block_size * sizeof(IndexType),
+                                            extent * block_size),
+                        reduce_blocks);
+                }
+            }
+        }
+    }
+}
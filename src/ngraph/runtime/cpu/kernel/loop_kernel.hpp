@@ -0,0 +1,209 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                enum class LoopKernelOpcode
+                {
+                    Abs,
+                    Negative,
+                    Relu,
+                    Sqrt,
+                    Exp,
+                    Log,
+                    Tanh,
+                    Sigmoid,
+                    Add,
+                    Subtract,
+                    Multiply,
+                    Divide,
+                    Maximum,
+                    Minimum,
+                    // Replicates element 0 of arg0 across the block (scalar Broadcast)
+                    Splat
+                };
+
+                struct LoopKernelInstruction
+                {
+                    LoopKernelOpcode opcode;
+                    size_t result;
+                    size_t arg0;
+                    size_t arg1;
+                };
+
+                /// \brief A fused elementwise expression compiled for loop_kernel.
+                ///
+                /// Registers [0, input_count) are the kernel inputs, the next output_count
+                /// registers are the kernel outputs and the remaining scratch_count registers
+                /// hold intermediate values of one block.
+                struct LoopKernelProgram
+                {
+                    size_t input_count = 0;
+                    size_t output_count = 0;
+                    size_t scratch_count = 0;
+                    // Inputs holding a single element which only feed Splat instructions
+                    std::vector<bool> scalar_inputs;
+                    std::vector<LoopKernelInstruction> instructions;
+                };
+
+                /// Number of elements evaluated together; each scratch register holds one block
+                static const size_t loop_kernel_block_size = 1024;
+
+                template <typename ElementType>
+                using LoopKernelArray = Eigen::Map<Eigen::Array<ElementType, Eigen::Dynamic, 1>>;
+
+                template <typename ElementType>
+                typename std::enable_if<std::is_floating_point<ElementType>::value>::type
+                    loop_kernel_transcendental(LoopKernelOpcode opcode,
+                                               LoopKernelArray<ElementType>& result,
+                                               const LoopKernelArray<ElementType>& arg)
+                {
+                    switch (opcode)
+                    {
+                    case LoopKernelOpcode::Sqrt: result = arg.sqrt(); break;
+                    case LoopKernelOpcode::Exp: result = arg.exp(); break;
+                    case LoopKernelOpcode::Log: result = arg.log(); break;
+                    case LoopKernelOpcode::Tanh: result = arg.tanh(); break;
+                    case LoopKernelOpcode::Sigmoid:
+                        result = (ElementType(1) + (-arg).exp()).inverse();
+                        break;
+                    default: throw ngraph_error("Unexpected loop kernel opcode");
+                    }
+                }
+
+                template <typename ElementType>
+                typename std::enable_if<!std::is_floating_point<ElementType>::value>::type
+                    loop_kernel_transcendental(LoopKernelOpcode opcode,
+                                               LoopKernelArray<ElementType>& result,
+                                               const LoopKernelArray<ElementType>& arg)
+                {
+                    throw ngraph_error("Loop kernel math functions require a floating point type");
+                }
+
+                template <typename ElementType>
+                void loop_kernel_evaluate(const LoopKernelInstruction& instruction,
+                                          ElementType* const* registers,
+                                          size_t count)
+                {
+                    LoopKernelArray<ElementType> result(registers[instruction.result], count);
+                    LoopKernelArray<ElementType> arg0(registers[instruction.arg0], count);
+                    LoopKernelArray<ElementType> arg1(registers[instruction.arg1], count);
+
+                    switch (instruction.opcode)
+                    {
+                    case LoopKernelOpcode::Abs: result = arg0.abs(); break;
+                    case LoopKernelOpcode::Negative: result = -arg0; break;
+                    case LoopKernelOpcode::Relu: result = arg0.max(ElementType(0)); break;
+                    case LoopKernelOpcode::Add: result = arg0 + arg1; break;
+                    case LoopKernelOpcode::Subtract: result = arg0 - arg1; break;
+                    case LoopKernelOpcode::Multiply: result = arg0 * arg1; break;
+                    case LoopKernelOpcode::Divide: result = arg0 / arg1; break;
+                    case LoopKernelOpcode::Maximum: result = arg0.max(arg1); break;
+                    case LoopKernelOpcode::Minimum: result = arg0.min(arg1); break;
+                    case LoopKernelOpcode::Splat:
+                        result.setConstant(registers[instruction.arg0][0]);
+                        break;
+                    default: loop_kernel_transcendental(instruction.opcode, result, arg0); break;
+                    }
+                }
+
+                /// \brief Evaluates a fused elementwise program over `count` elements.
+                ///
+                /// The tensors are walked in blocks of loop_kernel_block_size elements and the
+                /// whole program runs on a block before moving on, so intermediate values stay
+                /// in cache and every input and output is touched once. Each instruction is a
+                /// vectorized Eigen array expression; blocks are spread over the thread pool.
+                /// `buffer_indices` lists the input buffers followed by the output buffers.
+                template <typename ElementType>
+                void loop_kernel(const LoopKernelProgram& program,
+                                 void* const* buffer_data,
+                                 const std::vector<size_t>& buffer_indices,
+                                 size_t count)
+                {
+                    if (count == 0)
+                    {
+                        return;
+                    }
+
+                    const size_t block_size = loop_kernel_block_size;
+                    const size_t tensor_count = program.input_count + program.output_count;
+                    const size_t register_count = tensor_count + program.scratch_count;
+                    size_t block_count = (count + block_size - 1) / block_size;
+
+                    auto evaluate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> scratch(program.scratch_count * block_size);
+                        std::vector<ElementType*> registers(register_count);
+                        for (size_t r = 0; r < program.scratch_count; r++)
+                        {
+                            registers[tensor_count + r] = scratch.data() + r * block_size;
+                        }
+
+                        for (Eigen::Index b = first; b < last; b++)
+                        {
+                            size_t begin = b * block_size;
+                            size_t n = std::min(block_size, count - begin);
+                            for (size_t r = 0; r < tensor_count; r++)
+                            {
+                                ElementType* tensor =
+                                    static_cast<ElementType*>(buffer_data[buffer_indices[r]]);
+                                bool scalar = (r < program.input_count && program.scalar_inputs[r]);
+                                registers[r] = (scalar ? tensor : tensor + begin);
+                            }
+                            for (const LoopKernelInstruction& instruction : program.instructions)
+                            {
+                                loop_kernel_evaluate(instruction, registers.data(), n);
+                            }
+                        }
+                    };
+
+                    if (block_count == 1)
+                    {
+                        evaluate_blocks(0, 1);
+                        return;
+                    }
+
+                    size_t block_bytes = block_size * sizeof(ElementType);
+                    eigen::get_thread_pool_device().parallelFor(
+                        block_count,
+                        Eigen::TensorOpCost(program.input_count * block_bytes,
+                                            program.output_count * block_bytes,
+                                            program.instructions.size() * block_size),
+                        evaluate_blocks);
+                }
+            }
+        }
+    }
+}
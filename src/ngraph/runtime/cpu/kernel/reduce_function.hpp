@@ -109,7 +109,7 @@ namespace ngraph
                         static_cast<ElementType*>(input0), in_dims);
                     Reducer<ElementType> reducer(*static_cast<ElementType*>(input1),
                                                  external_function);
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         in.reduce(reduction_dims, reducer);
                 }
 
@@ -56,8 +56,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in1_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0;
-                    out.slice(indices, in1_dims).device(eigen::global_thread_pool_device) = in1;
+                    out.device(eigen::get_thread_pool_device()) = in0;
+                    out.slice(indices, in1_dims).device(eigen::get_thread_pool_device()) = in1;
                 }
 
                 template <typename ElementType, unsigned int Rank>
@@ -89,9 +89,9 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in1_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0;
+                    out.device(eigen::get_thread_pool_device()) = in0;
                     out.stridedSlice(start_indices, stop_indices, strides)
-                        .device(eigen::global_thread_pool_device) = in1;
+                        .device(eigen::get_thread_pool_device()) = in1;
                 }
             }
         }
@@ -62,7 +62,7 @@ namespace ngraph
                         return in(k);
                     };
 
-                    out.device(eigen::global_thread_pool_device) = in.generate(generator);
+                    out.device(eigen::get_thread_pool_device()) = in.generate(generator);
                 }
 
                 template <typename InputElementType, unsigned int Rank>
@@ -45,7 +45,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in2(
                         static_cast<ElementType*>(input2), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0.select(in1, in2);
+                    out.device(eigen::get_thread_pool_device()) = in0.select(in1, in2);
                 }
             }
         }
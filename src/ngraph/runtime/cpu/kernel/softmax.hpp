@@ -45,9 +45,9 @@ namespace ngraph
                         static_cast<ElementType *>(output), in_dims),
                         in(static_cast<ElementType *>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         (in - in.maximum().eval().reshape(rdims).broadcast(in_dims)).exp();
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         out * out.sum().inverse().eval().reshape(rdims).broadcast(in_dims);
                 }
 
@@ -92,9 +92,9 @@ namespace ngraph
                         static_cast<ElementType *>(output), in_dims),
                         in(static_cast<ElementType *>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         (in - in.maximum(axes).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         out * out.sum(axes).inverse().eval().reshape(rdims).broadcast(bcast);
                 }
 
@@ -124,9 +124,9 @@ namespace ngraph
                         static_cast<ElementType *>(output), in_dims),
                         in(static_cast<ElementType *>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         (in - in.maximum(axis).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         out * out.sum(axis).inverse().eval().reshape(rdims).broadcast(bcast);
                 }
 
@@ -0,0 +1,151 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The k largest (compute_max) or smallest elements of every slice along `axis`,
+                // ordered like reference::topk: by value, ties by index (descending indices for
+                // compute_max). NaN values come after all others. Slices run in parallel. Small
+                // k keeps a heap of the k best candidates while scanning the slice, larger k
+                // partitions the whole slice with nth_element; only the k winners are sorted.
+                template <typename ElementType, typename IndexType>
+                void topk(void* input,
+                          void* out_indices,
+                          void* out_values,
+                          const Shape& in_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max)
+                {
+                    using Entry = std::pair<ElementType, IndexType>;
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    IndexType* indices = static_cast<IndexType*>(out_indices);
+                    ElementType* values = static_cast<ElementType*>(out_values);
+
+                    size_t outer = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= in_shape[i];
+                    }
+                    size_t extent = in_shape.at(axis);
+                    size_t inner = 1;
+                    for (size_t i = axis + 1; i < in_shape.size(); i++)
+                    {
+                        inner *= in_shape[i];
+                    }
+                    if (outer * inner * k == 0)
+                    {
+                        return;
+                    }
+
+                    // a before b in the output, a strict weak order even with NaN values
+                    auto before = [compute_max](const Entry& a, const Entry& b) {
+                        bool a_is_nan = (a.first != a.first);
+                        bool b_is_nan = (b.first != b.first);
+                        if (a_is_nan != b_is_nan)
+                        {
+                            return b_is_nan;
+                        }
+                        return (compute_max ? a > b : a < b);
+                    };
+                    bool use_heap = (k * 16 <= extent);
+
+                    auto select = [=](Eigen::Index first, Eigen::Index last) {
+                        std::vector<Entry> workspace;
+                        workspace.reserve(use_heap ? k : extent);
+                        for (Eigen::Index slice = first; slice < last; slice++)
+                        {
+                            size_t o = slice / inner;
+                            size_t i = slice % inner;
+                            const ElementType* arg = in + o * extent * inner + i;
+                            workspace.clear();
+                            if (use_heap)
+                            {
+                                // Heap of the k best so far, its front being the worst of them
+                                for (size_t j = 0; j < k; j++)
+                                {
+                                    workspace.emplace_back(arg[j * inner],
+                                                           static_cast<IndexType>(j));
+                                }
+                                std::make_heap(workspace.begin(), workspace.end(), before);
+                                for (size_t j = k; j < extent; j++)
+                                {
+                                    Entry candidate(arg[j * inner], static_cast<IndexType>(j));
+                                    if (before(candidate, workspace.front()))
+                                    {
+                                        std::pop_heap(workspace.begin(), workspace.end(), before);
+                                        workspace.back() = candidate;
+                                        std::push_heap(workspace.begin(), workspace.end(), before);
+                                    }
+                                }
+                                std::sort_heap(workspace.begin(), workspace.end(), before);
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < extent; j++)
+                                {
+                                    workspace.emplace_back(arg[j * inner],
+                                                           static_cast<IndexType>(j));
+                                }
+                                if (k < extent)
+                                {
+                                    std::nth_element(workspace.begin(),
+                                                     workspace.begin() + k - 1,
+                                                     workspace.end(),
+                                                     before);
+                                }
+                                std::sort(workspace.begin(), workspace.begin() + k, before);
+                            }
+
+                            size_t out_index = o * k * inner + i;
+                            for (size_t j = 0; j < k; j++)
+                            {
+                                values[out_index] = workspace[j].first;
+                                indices[out_index] = workspace[j].second;
+                                out_index += inner;
+                            }
+                        }
+                    };
+                    eigen::get_thread_pool_device().parallelFor(
+                        outer * inner,
+                        Eigen::TensorOpCost(extent * sizeof(ElementType),
+                                            k * (sizeof(ElementType) + sizeof(IndexType)),
+                                            extent * (use_heap ? 2 : 8)),
+                        select);
+                }
+            }
+        }
+    }
+}
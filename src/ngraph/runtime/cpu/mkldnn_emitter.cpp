@@ -23,6 +23,7 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/dequantize.hpp"
 #include "ngraph/runtime/cpu/op/quantized_avg_pool.hpp"
@@ -33,6 +34,17 @@ using namespace ngraph::runtime::cpu;
 
 MKLDNNEmitter::~MKLDNNEmitter()
 {
+    auto& cache = MKLDNNPrimitiveCache::get_default();
+    for (auto& cached : m_cached_primitives)
+    {
+        MKLDNNPrimitiveCache::Primitives primitives;
+        for (auto index : cached.second)
+        {
+            primitives.emplace_back(m_mkldnn_primitives[index]);
+            m_mkldnn_primitives[index] = nullptr;
+        }
+        cache.release(cached.first, std::move(primitives));
+    }
     for (auto p : m_mkldnn_primitives)
         delete p;
 }
@@ -60,6 +72,31 @@ size_t MKLDNNEmitter::insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspa
     return (m_workspaces.size() - 1);
 }
 
+bool MKLDNNEmitter::acquire_cached_primitive(const std::string& key, size_t& index)
+{
+    auto primitives = MKLDNNPrimitiveCache::get_default().acquire(key);
+    if (primitives.empty())
+    {
+        return false;
+    }
+    std::vector<size_t> indices;
+    for (auto& primitive : primitives)
+    {
+        indices.push_back(insert_primitive(primitive.release()));
+    }
+    index = indices.back();
+    m_primitive_deps[index] = std::vector<size_t>(indices.begin(), indices.end() - 1);
+    m_cached_primitives.emplace_back(key, std::move(indices));
+    return true;
+}
+
+void MKLDNNEmitter::cache_primitive(const std::string& key, size_t index)
+{
+    std::vector<size_t> indices = m_primitive_deps.at(index);
+    indices.push_back(index);
+    m_cached_primitives.emplace_back(key, std::move(indices));
+}
+
 const std::vector<size_t>& MKLDNNEmitter::get_primitive_deps(size_t index) const
 {
     return m_primitive_deps.at(index);
@@ -262,6 +299,21 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
                                                 const ngraph::CoordinateDiff& padding_above,
                                                 const mkldnn::post_ops& pops)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("convolution_forward",
+                                              input_data_desc,
+                                              weights_desc,
+                                              result_desc,
+                                              strides,
+                                              dilation_strides,
+                                              padding_below,
+                                              padding_above,
+                                              pops);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_data_index = build_memory_primitive(input_data_desc);
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -297,6 +349,7 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     {
         throw ngraph_error("Could not create mkldnn convolution " + e.message);
     }
+    cache_primitive(key, conv_index);
     return conv_index;
 }
 
@@ -310,6 +363,22 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
                                                 const ngraph::CoordinateDiff& padding_above,
                                                 const mkldnn::post_ops& pops)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("convolution_bias_forward",
+                                              input_data_desc,
+                                              weights_desc,
+                                              bias_desc,
+                                              result_desc,
+                                              strides,
+                                              dilation_strides,
+                                              padding_below,
+                                              padding_above,
+                                              pops);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     const size_t input_data_index = build_memory_primitive(input_data_desc);
     const size_t weights_index = build_memory_primitive(weights_desc);
     const size_t bias_index = build_memory_primitive(bias_desc);
@@ -346,6 +415,7 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     {
         throw ngraph_error("Could not create convolution " + e.message);
     }
+    cache_primitive(key, conv_index);
     return conv_index;
 }
 
@@ -359,6 +429,21 @@ size_t MKLDNNEmitter::build_convolution_backward_weights_bias(
     const ngraph::CoordinateDiff& ng_padding_below,
     const ngraph::CoordinateDiff& ng_padding_above)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("convolution_backward_weights_bias",
+                                              in_data_desc,
+                                              in_delta_desc,
+                                              out_weights_delta_desc,
+                                              out_bias_delta_desc,
+                                              ng_strides,
+                                              ng_dilation_strides,
+                                              ng_padding_below,
+                                              ng_padding_above);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     const size_t in_data_index = build_memory_primitive(in_data_desc);
     const size_t in_delta_index = build_memory_primitive(in_delta_desc);
     const size_t out_weights_delta_index = build_memory_primitive(out_weights_delta_desc);
@@ -404,6 +489,7 @@ size_t MKLDNNEmitter::build_convolution_backward_weights_bias(
 
     m_primitive_deps[conv_index] = {
         in_data_index, in_delta_index, out_weights_delta_index, out_bias_delta_index};
+    cache_primitive(key, conv_index);
     return conv_index;
 }
 
@@ -416,6 +502,20 @@ size_t
                                                       const ngraph::CoordinateDiff& padding_below,
                                                       const ngraph::CoordinateDiff& padding_above)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("convolution_backward_weights",
+                                              input_desc,
+                                              delta_desc,
+                                              result_desc,
+                                              strides,
+                                              dilation_strides,
+                                              padding_below,
+                                              padding_above);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -448,6 +548,7 @@ size_t
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -459,6 +560,20 @@ size_t MKLDNNEmitter::build_convolution_backward_data(const mkldnn::memory::desc
                                                       const ngraph::CoordinateDiff& padding_below,
                                                       const ngraph::CoordinateDiff& padding_above)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("convolution_backward_data",
+                                              weights_desc,
+                                              delta_desc,
+                                              result_desc,
+                                              strides,
+                                              dilation_strides,
+                                              padding_below,
+                                              padding_above);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -491,6 +606,7 @@ size_t MKLDNNEmitter::build_convolution_backward_data(const mkldnn::memory::desc
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {weights_index, delta_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -502,6 +618,20 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
                                             const ngraph::Shape& padding_below,
                                             const ngraph::Shape& padding_above)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("pooling_forward",
+                                              pooling_algorithm,
+                                              input_desc,
+                                              result_desc,
+                                              window_strides,
+                                              window_shape,
+                                              padding_below,
+                                              padding_above);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -520,6 +650,7 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -531,6 +662,20 @@ size_t MKLDNNEmitter::build_pooling_backward(mkldnn::algorithm pooling_algorithm
                                              const ngraph::Shape& padding_below,
                                              const ngraph::Shape& padding_above)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("pooling_backward",
+                                              pooling_algorithm,
+                                              diff_dst_desc,
+                                              diff_src_desc,
+                                              window_strides,
+                                              window_shape,
+                                              padding_below,
+                                              padding_above);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(diff_dst_desc);
     size_t result_index = build_memory_primitive(diff_src_desc);
 
@@ -558,6 +703,7 @@ size_t MKLDNNEmitter::build_pooling_backward(mkldnn::algorithm pooling_algorithm
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -705,6 +851,13 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_backward(
 size_t MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
                                     const mkldnn::memory::desc& result_desc)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("reorder", input_desc, result_desc);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -712,6 +865,7 @@ size_t MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
         new mkldnn::reorder(*m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -739,6 +893,19 @@ size_t MKLDNNEmitter::build_lrn_forward(const mkldnn::memory::desc& input_desc,
                                         float bias,
                                         int nsize)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("lrn_forward",
+                                              input_desc,
+                                              result_desc,
+                                              alpha,
+                                              beta,
+                                              bias,
+                                              nsize);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -756,12 +923,20 @@ size_t MKLDNNEmitter::build_lrn_forward(const mkldnn::memory::desc& input_desc,
         lrn_prim_desc, *m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
 size_t MKLDNNEmitter::build_relu_forward(const mkldnn::memory::desc& input_desc,
                                          const mkldnn::memory::desc& result_desc)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("relu_forward", input_desc, result_desc);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -772,6 +947,7 @@ size_t MKLDNNEmitter::build_relu_forward(const mkldnn::memory::desc& input_desc,
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -779,6 +955,13 @@ size_t MKLDNNEmitter::build_relu_backward(const mkldnn::memory::desc& input_desc
                                           const mkldnn::memory::desc& delta_desc,
                                           const mkldnn::memory::desc& result_desc)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("relu_backward", input_desc, delta_desc, result_desc);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -793,12 +976,20 @@ size_t MKLDNNEmitter::build_relu_backward(const mkldnn::memory::desc& input_desc
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
 size_t MKLDNNEmitter::build_sigmoid_forward(const mkldnn::memory::desc& input_desc,
                                             const mkldnn::memory::desc& result_desc)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("sigmoid_forward", input_desc, result_desc);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -813,6 +1004,7 @@ size_t MKLDNNEmitter::build_sigmoid_forward(const mkldnn::memory::desc& input_de
                                                      *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -820,6 +1012,16 @@ size_t MKLDNNEmitter::build_sigmoid_backward(const mkldnn::memory::desc& input_d
                                              const mkldnn::memory::desc& delta_desc,
                                              const mkldnn::memory::desc& result_desc)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("sigmoid_backward",
+                                              input_desc,
+                                              delta_desc,
+                                              result_desc);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -839,6 +1041,7 @@ size_t MKLDNNEmitter::build_sigmoid_backward(const mkldnn::memory::desc& input_d
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -850,6 +1053,17 @@ size_t MKLDNNEmitter::build_elementwise_add(
     const std::vector<mkldnn::memory::primitive_desc>& inputs_pd)
 
 {
+    auto key = MKLDNNPrimitiveCache::make_key("elementwise_add",
+                                              input0_data_desc,
+                                              input1_data_desc,
+                                              result_desc,
+                                              scale_vector);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     std::vector<mkldnn::memory::primitive::at> inputs_primitive;
 
     size_t input0_data_index = build_memory_primitive(input0_data_desc);
@@ -867,6 +1081,7 @@ size_t MKLDNNEmitter::build_elementwise_add(
         new mkldnn::sum(sum_pd, inputs_primitive, *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[add_index] = {input0_data_index, input1_data_index, result_index};
+    cache_primitive(key, add_index);
     return add_index;
 }
 
@@ -880,6 +1095,22 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
                                               bool bn_training_flag,
                                               const mkldnn::post_ops& pops)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("batchnorm_forward",
+                                              input_desc,
+                                              weights_desc,
+                                              result_desc,
+                                              mean_desc,
+                                              variance_desc,
+                                              eps,
+                                              use_global_stats,
+                                              bn_training_flag,
+                                              pops);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -906,6 +1137,7 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
 
         m_primitive_deps[batchnorm_index] = {
             input_index, weights_index, result_index, mean_index, variance_index};
+        cache_primitive(key, batchnorm_index);
         return batchnorm_index;
     }
     else
@@ -926,6 +1158,7 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
 
         m_primitive_deps[batchnorm_index] = {
             input_index, mean_index, variance_index, weights_index, result_index};
+        cache_primitive(key, batchnorm_index);
         return batchnorm_index;
     }
 }
@@ -939,6 +1172,21 @@ size_t MKLDNNEmitter::build_batchnorm_backward(const mkldnn::memory::desc& weigh
                                                const mkldnn::memory::desc& dweights_desc,
                                                const double eps)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("batchnorm_backward",
+                                              weights_desc,
+                                              input_desc,
+                                              mean_desc,
+                                              variance_desc,
+                                              delta_desc,
+                                              dinput_desc,
+                                              dweights_desc,
+                                              eps);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t input_index = build_memory_primitive(input_desc);
     size_t mean_index = build_memory_primitive(mean_desc);
@@ -974,7 +1222,8 @@ size_t MKLDNNEmitter::build_batchnorm_backward(const mkldnn::memory::desc& weigh
                                          delta_index,
                                          dinput_index,
                                          dweights_index};
-    return batchnorm_index;
+    cache_primitive(key, batchnorm_index);
+        return batchnorm_index;
 }
 
 size_t MKLDNNEmitter::build_rnn_forward(const mkldnn::memory::desc& src_layer_desc,
@@ -1038,6 +1287,13 @@ size_t MKLDNNEmitter::build_concat(const std::vector<mkldnn::memory::desc>& inpu
                                    const mkldnn::memory::desc& result_desc,
                                    const size_t concat_dim)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("concat", inputs_data_desc, result_desc, concat_dim);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     std::vector<mkldnn::memory::primitive::at> inputs_primitive;
     std::vector<size_t> inputs_data_index;
     std::vector<size_t> in_out_index;
@@ -1069,6 +1325,7 @@ size_t MKLDNNEmitter::build_concat(const std::vector<mkldnn::memory::desc>& inpu
     }
     in_out_index.push_back(result_index);
     m_primitive_deps[concat_index] = in_out_index;
+    cache_primitive(key, concat_index);
     return concat_index;
 }
 
@@ -1076,6 +1333,16 @@ size_t MKLDNNEmitter::build_softmax_forward(const mkldnn::memory::desc& input_de
                                             const mkldnn::memory::desc& result_desc,
                                             int softmax_axis)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("softmax_forward",
+                                              input_desc,
+                                              result_desc,
+                                              softmax_axis);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -1086,6 +1353,7 @@ size_t MKLDNNEmitter::build_softmax_forward(const mkldnn::memory::desc& input_de
                                     *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -1093,6 +1361,13 @@ size_t MKLDNNEmitter::build_bounded_relu(const mkldnn::memory::desc& input_desc,
                                          const mkldnn::memory::desc& result_desc,
                                          float alpha)
 {
+    auto key = MKLDNNPrimitiveCache::make_key("bounded_relu", input_desc, result_desc, alpha);
+    size_t cached_index;
+    if (acquire_cached_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -1107,5 +1382,6 @@ size_t MKLDNNEmitter::build_bounded_relu(const mkldnn::memory::desc& input_desc,
                                                      *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    cache_primitive(key, primitive_index);
     return primitive_index;
 }
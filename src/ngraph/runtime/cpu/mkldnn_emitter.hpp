@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -526,11 +527,20 @@ namespace ngraph
                                               std::vector<float>& quant_util);
 
             private:
+                /// \brief Inserts primitives built for key by an earlier emitter, taken out of
+                ///     the process-wide MKLDNNPrimitiveCache. Returns false on a cache miss.
+                bool acquire_cached_primitive(const std::string& key, size_t& index);
+                /// \brief Hands the primitive at index and its dependencies over to the cache
+                ///     once this emitter is destroyed.
+                void cache_primitive(const std::string& key, size_t index);
+
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
                 std::unordered_map<size_t, std::vector<size_t>> m_primitive_deps;
                 std::vector<std::unique_ptr<MKLDNNWorkspace>> m_workspaces;
                 std::vector<char*> m_workspace_bufs;
+                // Primitive indices returned to the cache on destruction, dependencies first
+                std::vector<std::pair<std::string, std::vector<size_t>>> m_cached_primitives;
             };
         }
     }
@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+using namespace ngraph::runtime::cpu;
+
+MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+    : m_capacity(512)
+{
+    const auto env_capacity = std::getenv("NGRAPH_MKLDNN_CACHE_SIZE");
+    if (env_capacity != nullptr)
+    {
+        m_capacity = std::strtoul(env_capacity, nullptr, 10);
+    }
+}
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::get_default()
+{
+    // Never destroyed, emitters of Functions in static storage return their primitives to it
+    // during static destruction
+    static MKLDNNPrimitiveCache* s_cache = new MKLDNNPrimitiveCache();
+    return *s_cache;
+}
+
+MKLDNNPrimitiveCache::Primitives MKLDNNPrimitiveCache::acquire(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        m_miss_count++;
+        return Primitives();
+    }
+    m_hit_count++;
+    auto entry = it->second;
+    m_index.erase(it);
+    Primitives primitives = std::move(entry->second);
+    m_entries.erase(entry);
+    return primitives;
+}
+
+void MKLDNNPrimitiveCache::release(const std::string& key, Primitives primitives)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0)
+    {
+        return;
+    }
+    m_entries.emplace_front(key, std::move(primitives));
+    m_index.emplace(key, m_entries.begin());
+    evict();
+}
+
+void MKLDNNPrimitiveCache::evict()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        auto last = std::prev(m_entries.end());
+        auto range = m_index.equal_range(last->first);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == last)
+            {
+                m_index.erase(it);
+                break;
+            }
+        }
+        m_entries.erase(last);
+    }
+}
+
+void MKLDNNPrimitiveCache::set_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+size_t MKLDNNPrimitiveCache::get_capacity() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+size_t MKLDNNPrimitiveCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t MKLDNNPrimitiveCache::get_hit_count() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hit_count;
+}
+
+size_t MKLDNNPrimitiveCache::get_miss_count() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_miss_count;
+}
+
+void MKLDNNPrimitiveCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+}
+
+void MKLDNNPrimitiveCache::append_value(std::string& key, const mkldnn::memory::desc& desc)
+{
+    const mkldnn_memory_desc_t& md = desc.data;
+    append(key, md.ndims, md.data_type, md.format);
+    for (int i = 0; i < md.ndims; i++)
+    {
+        append(key, md.dims[i]);
+    }
+    // Named formats imply their blocking, but blocked descriptors built from strides do not
+    if (md.format == mkldnn_blocked)
+    {
+        const auto& blocking = md.layout_desc.blocking;
+        for (int i = 0; i < md.ndims; i++)
+        {
+            append(key,
+                   blocking.block_dims[i],
+                   blocking.strides[0][i],
+                   blocking.strides[1][i],
+                   blocking.padding_dims[i],
+                   blocking.offset_padding_to_data[i]);
+        }
+        append(key, blocking.offset_padding);
+    }
+}
+
+void MKLDNNPrimitiveCache::append_value(std::string& key, const mkldnn::post_ops& ops)
+{
+    append(key, ops.len());
+    for (int i = 0; i < ops.len(); i++)
+    {
+        float scale = 0.0f;
+        if (ops.kind(i) == mkldnn::primitive::kind::sum)
+        {
+            ops.get_params_sum(i, scale);
+            append(key, ops.kind(i), scale);
+        }
+        else
+        {
+            mkldnn::algorithm algorithm;
+            float alpha = 0.0f;
+            float beta = 0.0f;
+            ops.get_params_eltwise(i, scale, algorithm, alpha, beta);
+            append(key, ops.kind(i), scale, algorithm, alpha, beta);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Process-wide cache of MKLDNN primitives, shared by all MKLDNNEmitters.
+            ///
+            /// An entry holds the memory primitives an op primitive is bound to followed by the
+            /// op primitive itself, keyed by the descriptors and attributes they were built
+            /// from. The data handles of the memory primitives are set on every call, so an
+            /// entry is leased to one emitter at a time: emitters take entries out when they
+            /// build primitives and hand them back when they are destroyed, which lets later
+            /// compilations of similar Functions skip the descriptor search and JIT code
+            /// generation. Primitives are therefore never shared by Functions that are alive at
+            /// the same time; each of them builds its own, and only Functions compiled after
+            /// another one was destroyed reuse its primitives. Idle entries beyond the capacity
+            /// are evicted least recently used first. The capacity is read from
+            /// NGRAPH_MKLDNN_CACHE_SIZE and defaults to 512.
+            class MKLDNNPrimitiveCache
+            {
+            public:
+                using Primitives = std::vector<std::unique_ptr<mkldnn::primitive>>;
+
+                static MKLDNNPrimitiveCache& get_default();
+
+                /// \brief Builds a key from a primitive kind and the descriptors, shapes and
+                ///     scalar attributes the primitive is created from.
+                template <typename... Args>
+                static std::string make_key(const char* kind, const Args&... args)
+                {
+                    std::string key(kind);
+                    append(key, args...);
+                    return key;
+                }
+
+                /// \brief Takes an idle entry for key out of the cache. Returns an empty vector
+                ///     if there is none.
+                Primitives acquire(const std::string& key);
+
+                /// \brief Returns an entry to the cache, evicting the least recently released
+                ///     entries if the cache is over capacity.
+                void release(const std::string& key, Primitives primitives);
+
+                void set_capacity(size_t capacity);
+                size_t get_capacity() const;
+                /// \brief Number of idle entries
+                size_t size() const;
+                size_t get_hit_count() const;
+                size_t get_miss_count() const;
+                void clear();
+
+            private:
+                MKLDNNPrimitiveCache();
+                void evict();
+
+                static void append(std::string&) {}
+                template <typename T, typename... Args>
+                static void append(std::string& key, const T& value, const Args&... args)
+                {
+                    append_value(key, value);
+                    append(key, args...);
+                }
+
+                template <typename T>
+                static typename std::enable_if<std::is_arithmetic<T>::value ||
+                                               std::is_enum<T>::value>::type
+                    append_value(std::string& key, const T& value)
+                {
+                    char bytes[sizeof(T)];
+                    std::memcpy(bytes, &value, sizeof(T));
+                    key.append(bytes, sizeof(T));
+                }
+                template <typename T>
+                static void append_value(std::string& key, const std::vector<T>& values)
+                {
+                    append_value(key, values.size());
+                    for (const auto& value : values)
+                    {
+                        append_value(key, value);
+                    }
+                }
+                static void append_value(std::string& key, const mkldnn::memory::desc& desc);
+                static void append_value(std::string& key, const mkldnn::post_ops& ops);
+
+                mutable std::mutex m_mutex;
+                // Idle entries, most recently released first
+                std::list<std::pair<std::string, Primitives>> m_entries;
+                std::unordered_multimap<std::string,
+                                        std::list<std::pair<std::string, Primitives>>::iterator>
+                    m_index;
+                size_t m_capacity;
+                size_t m_hit_count = 0;
+                size_t m_miss_count = 0;
+            };
+        }
+    }
+}
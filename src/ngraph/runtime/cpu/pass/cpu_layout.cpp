@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -33,6 +34,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/op.hpp"
@@ -51,7 +53,6 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/dequantize.hpp"
-#include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/runtime/cpu/op/quantized_avg_pool.hpp"
@@ -63,6 +64,151 @@ using namespace mkldnn;
 using namespace ngraph;
 using namespace ngraph::runtime::cpu;
 
+// Bytes read and written by one conversion of the tensor
+static size_t conversion_bytes(const descriptor::Output& output)
+{
+    return shape_size(output.get_shape()) * output.get_element_type().size();
+}
+
+// Returns a conversion of output to required_md already inserted for another consumer
+shared_ptr<Node>
+    runtime::cpu::pass::CPULayout::find_conversion(const descriptor::Output& output,
+                                                   const memory::desc& required_md)
+{
+    for (auto input : output.get_inputs())
+    {
+        auto node = input->get_node();
+        if (!dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            continue;
+        }
+        auto layout = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+            node->get_output_tensor_view()->get_tensor_view_layout());
+        if (layout && layout->is_mkldnn_layout() &&
+            mkldnn_utils::compare_mkldnn_mds(layout->get_mkldnn_md(), required_md))
+        {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+// Converts output to required_md for consumer. Consumers requiring the same layout share one
+// conversion, which is recorded for CPU_Backend::get_layout_conversions()
+shared_ptr<Node> runtime::cpu::pass::CPULayout::insert_conversion(
+    runtime::cpu::CPU_ExternalFunction* external_function,
+    const descriptor::Output& output,
+    const memory::desc& required_md,
+    const shared_ptr<Node>& consumer)
+{
+    auto& conversions = external_function->get_layout_conversions();
+    auto conversion = find_conversion(output, required_md);
+    if (conversion)
+    {
+        for (auto& record : conversions)
+        {
+            if (record.Name == conversion->get_name())
+            {
+                record.Consumers.push_back(consumer->get_name());
+            }
+        }
+        NGRAPH_DEBUG << "Reused conversion node " << conversion->get_name() << " for "
+                     << consumer->get_name();
+        return conversion;
+    }
+
+    auto tv = output.get_tensor_view();
+    auto tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(tv->get_tensor_view_layout());
+    auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
+    layout->set_mkldnn_md(required_md);
+    conversion = std::shared_ptr<Node>(
+        new runtime::cpu::op::ConvertLayout(output.get_node(), output.get_index(), layout));
+
+    runtime::cpu::LayoutConversion record;
+    record.Name = conversion->get_name();
+    record.Output = conversion->get_output_tensor(0).get_name();
+    record.Input = tv->get_tensor().get_name();
+    record.Consumers.push_back(consumer->get_name());
+    record.InputFormat = mkldnn_utils::get_mkldnn_format_string(
+        static_cast<memory::format>(tvl->get_mkldnn_md().data.format));
+    record.OutputFormat = mkldnn_utils::get_mkldnn_format_string(
+        static_cast<memory::format>(required_md.data.format));
+    record.Bytes = conversion_bytes(output);
+    conversions.push_back(record);
+    return conversion;
+}
+
+// The MKLDNN Add kernel runs on any layout as long as inputs and output agree. It is the only
+// op whose layout is picked among those of several inputs: unary MKLDNN ops and BatchNorm keep
+// the layout of their data input and Concat takes the layout MKLDNN chooses, so only Add is
+// costed.
+// Each candidate, taken from the layouts of the inputs, is charged the bytes of the reorders it
+// causes: inputs in other layouts, unless already converted for another consumer, consumers
+// without MKLDNN kernels when it is not the native layout, and MKLDNN consumers when it is not
+// blocked while another candidate is, since their kernels prefer blocked layouts and would
+// reorder anyway. The first input's layout wins ties, keeping whole regions blocked once a
+// blocked layout enters them.
+memory::desc runtime::cpu::pass::CPULayout::choose_add_layout(const shared_ptr<Node>& node)
+{
+    vector<memory::desc> candidates;
+    bool have_blocked = false;
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        auto md = mkldnn_utils::get_input_mkldnn_md(node.get(), i);
+        have_blocked |= mkldnn_utils::is_mkldnn_blocked_data_format(
+            static_cast<memory::format>(md.data.format));
+        candidates.push_back(md);
+    }
+
+    auto shape = node->get_output_shape(0);
+    auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
+        shape, ngraph::row_major_strides(shape), node->get_output_element_type(0));
+    size_t output_bytes = shape_size(shape) * node->get_output_element_type(0).size();
+
+    size_t best = 0;
+    size_t best_cost = std::numeric_limits<size_t>::max();
+    for (size_t c = 0; c < candidates.size(); c++)
+    {
+        const auto& candidate = candidates[c];
+        size_t cost = 0;
+        for (size_t i = 0; i < node->get_input_size(); i++)
+        {
+            const auto& output = node->get_inputs().at(i).get_output();
+            if (!mkldnn_utils::compare_mkldnn_mds(candidates[i], candidate) &&
+                !find_conversion(output, candidate))
+            {
+                cost += conversion_bytes(output);
+            }
+        }
+        bool is_native = mkldnn_utils::compare_mkldnn_mds(candidate, native_md);
+        bool is_blocked = mkldnn_utils::is_mkldnn_blocked_data_format(
+            static_cast<memory::format>(candidate.data.format));
+        for (auto user : node->get_users())
+        {
+            if (user->is_output())
+            {
+                continue;
+            }
+            if (!mkldnn_utils::use_mkldnn_kernel(user.get()))
+            {
+                cost += is_native ? 0 : output_bytes;
+            }
+            else if (have_blocked && !is_blocked)
+            {
+                cost += output_bytes;
+            }
+        }
+        NGRAPH_DEBUG << "Layout " << candidate.data.format << " for " << node->get_name()
+                     << " costs " << cost << " bytes of reorders";
+        if (cost < best_cost)
+        {
+            best = c;
+            best_cost = cost;
+        }
+    }
+    return candidates[best];
+}
+
 // Check if the input layout matches the layout requested in `required_mds`
 // If not, insert a layout conversion node between the input tensorview and
 // the `node`. For now, only MKLDNN nodes/kernels can request specific layouts
@@ -105,10 +251,8 @@ shared_ptr<Node> runtime::cpu::pass::CPULayout::insert_input_conversions(
 
         if (!mkldnn_utils::compare_mkldnn_mds(tvl->get_mkldnn_md(), required_mds[index]))
         {
-            auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
-            layout->set_mkldnn_md(required_mds[index]);
-            auto new_node = std::shared_ptr<Node>(
-                new runtime::cpu::op::ConvertLayout(output.get_node(), output.get_index(), layout));
+            auto new_node =
+                insert_conversion(external_function, output, required_mds[index], node);
             new_args.push_back(new_node);
             replace_node = true;
             NGRAPH_DEBUG << "Inserted conversion node " << new_node->get_name() << " between "
@@ -188,10 +332,7 @@ void runtime::cpu::pass::CPULayout::set_native_layouts(
                 mkldnn_utils::create_blocked_mkldnn_md(shape, cpu_tvl->get_strides(), et);
             if (!mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
             {
-                auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
-                layout->set_mkldnn_md(native_md);
-                auto new_node = std::shared_ptr<Node>(new runtime::cpu::op::ConvertLayout(
-                    output.get_node(), output.get_index(), layout));
+                auto new_node = insert_conversion(external_function, output, native_md, node);
                 new_args.push_back(new_node);
                 if (use_replace)
                 {
@@ -1511,13 +1652,13 @@ namespace ngraph
                 {
                     if (mkldnn_utils::use_mkldnn_kernel(node.get()))
                     {
-                        auto input0_md = mkldnn_utils::get_input_mkldnn_md(node.get(), 0);
+                        auto md = choose_add_layout(node);
 
                         vector<memory::desc> i_mds;
                         vector<memory::desc> o_mds;
-                        i_mds.push_back(input0_md);
-                        i_mds.push_back(input0_md);
-                        o_mds.push_back(input0_md);
+                        i_mds.push_back(md);
+                        i_mds.push_back(md);
+                        o_mds.push_back(md);
                         node = insert_input_conversions(external_function, node, i_mds);
                         set_output_layouts(node, o_mds);
                     }
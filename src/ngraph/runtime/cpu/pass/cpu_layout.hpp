@@ -53,6 +53,16 @@ namespace ngraph
 
                 private:
                     CPU_ExternalFunction* m_external_function;
+                    static std::shared_ptr<Node>
+                        find_conversion(const descriptor::Output& output,
+                                        const mkldnn::memory::desc& required_md);
+                    static std::shared_ptr<Node>
+                        insert_conversion(CPU_ExternalFunction* external_function,
+                                          const descriptor::Output& output,
+                                          const mkldnn::memory::desc& required_md,
+                                          const std::shared_ptr<Node>& consumer);
+                    static mkldnn::memory::desc
+                        choose_add_layout(const std::shared_ptr<Node>& node);
                     static std::shared_ptr<Node> insert_input_conversions(
                         CPU_ExternalFunction* external_function,
                         std::shared_ptr<Node>& node,
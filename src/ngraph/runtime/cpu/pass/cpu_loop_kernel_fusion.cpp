@@ -23,14 +23,23 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 
@@ -56,32 +65,19 @@ public:
     {
         for (auto n : f->get_ordered_ops())
         {
+            m_positions.insert(std::make_pair(n, m_positions.size()));
             if (is_fusible(n))
             {
-                auto arg_from_fusible_group = collect_fusible_args(n);
+                auto head = find_group(n);
                 // create a new group
-                if (!arg_from_fusible_group)
+                if (!head)
                 {
-                    m_heads.insert(std::make_pair(n, n));
-                    m_graphs.insert(std::make_pair(n, LKGraph{{n}, n->get_arguments()}));
+                    head = n;
+                    m_graphs.insert(std::make_pair(head, LKGraph{{}, {}}));
                     NGRAPH_DEBUG << "Created a new group for " << n->get_name();
-                    log_group(n);
-                }
-                else
-                {
-                    auto smallest_head = m_heads.at(arg_from_fusible_group);
-                    auto& lkgraph = m_graphs.at(smallest_head);
-                    lkgraph.m_nodes.push_back(n);
-                    for (auto arg : n->get_arguments())
-                    {
-                        if (is_leaf(arg))
-                        {
-                            lkgraph.m_inputs.push_back(arg);
-                        }
-                    }
-                    m_heads.insert(std::make_pair(n, smallest_head));
-                    log_group(smallest_head);
                 }
+                add_member(n, head);
+                log_group(head);
             }
         }
 
@@ -95,7 +91,16 @@ public:
         {
             auto& lkg = e.second;
 
-            NodeVector member_outputs = ngraph::get_subgraph_outputs(lkg.m_nodes, NodeVector{});
+            // get_subgraph_outputs lists a member once per external user
+            NodeVector member_outputs;
+            for (auto output : ngraph::get_subgraph_outputs(lkg.m_nodes, NodeVector{}))
+            {
+                if (std::find(member_outputs.begin(), member_outputs.end(), output) ==
+                    member_outputs.end())
+                {
+                    member_outputs.push_back(output);
+                }
+            }
             auto lk = std::make_shared<runtime::cpu::op::LoopKernel>(
                 lkg.m_nodes, member_outputs, lkg.m_inputs);
             lks.push_back(lk);
@@ -108,69 +113,240 @@ private:
     {
         static const std::set<std::type_index> fusible_ops_set{TI(ngraph::op::Abs),
                                                                TI(ngraph::op::Add),
+                                                               TI(ngraph::op::Divide),
+                                                               TI(ngraph::op::Exp),
+                                                               TI(ngraph::op::Log),
+                                                               TI(ngraph::op::Maximum),
+                                                               TI(ngraph::op::Minimum),
+                                                               TI(ngraph::op::Multiply),
                                                                TI(ngraph::op::Negative),
-                                                               TI(ngraph::op::Subtract),
                                                                TI(ngraph::op::Relu),
-                                                               TI(ngraph::op::Minimum),
-                                                               TI(ngraph::op::Maximum)};
+                                                               TI(ngraph::op::Sigmoid),
+                                                               TI(ngraph::op::Sqrt),
+                                                               TI(ngraph::op::Subtract),
+                                                               TI(ngraph::op::Tanh)};
+
+        // Transcendental ops, which the kernel only evaluates on real types
+        static const std::set<std::type_index> real_ops_set{TI(ngraph::op::Exp),
+                                                            TI(ngraph::op::Log),
+                                                            TI(ngraph::op::Sigmoid),
+                                                            TI(ngraph::op::Sqrt),
+                                                            TI(ngraph::op::Tanh)};
 
         const Node& node = *n;
-        return fusible_ops_set.count(TI(node)) != 0;
+        return fusible_ops_set.count(TI(node)) != 0 && n->get_outputs().size() == 1 &&
+               is_supported_type(n->get_element_type()) &&
+               (n->get_element_type().is_real() || real_ops_set.count(TI(node)) == 0) &&
+               !runtime::cpu::mkldnn_utils::use_mkldnn_kernel(n.get());
+    }
 
-        // return (std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n) ||
-        //         std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n));
+    // Types the LoopKernel builder instantiates the kernel for
+    static bool is_supported_type(const element::Type& type)
+    {
+        return type == element::f32 || type == element::f64 || type == element::i32 ||
+               type == element::i64;
     }
 
-    bool is_leaf(std::shared_ptr<Node> src) { return src->is_parameter() || src->is_constant(); }
-    void prune_graphs(size_t min_nodes_to_fuse)
+    // A broadcast of a scalar read only by `user` is pulled into the group of `user`
+    // and evaluated as a splat inside the loop
+    bool is_splat(std::shared_ptr<Node> arg, std::shared_ptr<Node> user) const
     {
-        for (auto it = m_graphs.begin(); it != m_graphs.end();)
+        const Node& node = *arg;
+        if (TI(node) != TI(ngraph::op::Broadcast) || m_heads.count(arg) != 0 ||
+            shape_size(arg->get_argument(0)->get_shape()) != 1 ||
+            !is_supported_type(arg->get_element_type()) ||
+            runtime::cpu::mkldnn_utils::use_mkldnn_kernel(arg.get()))
         {
-            if (it->second.m_nodes.size() < min_nodes_to_fuse)
-            {
-                it = m_graphs.erase(it);
-            }
-            else
+            return false;
+        }
+        for (auto u : arg->get_users())
+        {
+            if (u != user)
             {
-                it++;
+                return false;
             }
         }
+        return true;
     }
 
-    void log_group(std::shared_ptr<Node> head) const
+    static bool is_leaf(std::shared_ptr<Node> src)
     {
-        NGRAPH_DEBUG << "Group leader : " << head->get_name() << std::endl;
-        NGRAPH_DEBUG << "Group members : " << m_graphs.at(head).m_nodes << std::endl;
-        NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << std::endl;
+        return src->is_parameter() || src->is_constant();
+    }
+
+    // Every member of a group but its splats follows its head in topological order, so a node
+    // computed before the head (or a leaf) can't depend on the group and is a safe kernel input.
+    // Admitting only such inputs keeps LoopKernels from forming cycles with each other.
+    bool is_safe_input(std::shared_ptr<Node> arg, std::shared_ptr<Node> head) const
+    {
+        return is_leaf(arg) || m_positions.at(arg) < m_positions.at(head);
+    }
+
+    // `arg` may feed the group of `head` once the groups led by `merged` are part of it
+    bool is_valid_input(std::shared_ptr<Node> arg,
+                        std::shared_ptr<Node> head,
+                        const std::set<std::shared_ptr<Node>>& merged) const
+    {
+        return (m_heads.count(arg) != 0 && merged.count(m_heads.at(arg)) != 0) ||
+               is_safe_input(arg, head);
     }
 
-    std::shared_ptr<Node> collect_fusible_args(std::shared_ptr<Node> n)
+    bool can_join(std::shared_ptr<Node> n,
+                  std::shared_ptr<Node> head,
+                  const std::set<std::shared_ptr<Node>>& merged) const
     {
-        std::shared_ptr<Node> arg_from_fusible_group;
+        for (auto arg : n->get_arguments())
+        {
+            if (is_splat(arg, n))
+            {
+                arg = arg->get_argument(0);
+            }
+            if (!is_valid_input(arg, head, merged))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::shared_ptr<Node> find_group(std::shared_ptr<Node> n)
+    {
+        NodeVector heads;
         for (auto arg : n->get_arguments())
         {
             // an argument is fusible and a part of some group
             NGRAPH_DEBUG << "Considering " << arg->get_name();
-            if (m_heads.count(arg) != 0)
+            if (m_heads.count(arg) == 0)
+            {
+                continue;
+            }
+            auto head = m_heads.at(arg);
+            if (head->get_shape() == n->get_shape() &&
+                head->get_element_type() == n->get_element_type() &&
+                std::find(heads.begin(), heads.end(), head) == heads.end())
             {
-                if (!arg_from_fusible_group)
+                heads.push_back(head);
+            }
+        }
+
+        // n connects several groups; fold them into the one with the earliest head if
+        // none of them reads a value computed after that head outside of the groups
+        if (heads.size() > 1)
+        {
+            std::sort(heads.begin(), heads.end(), [this](const std::shared_ptr<Node>& a,
+                                                         const std::shared_ptr<Node>& b) {
+                return m_positions.at(a) < m_positions.at(b);
+            });
+            std::set<std::shared_ptr<Node>> merged(heads.begin(), heads.end());
+            bool mergeable = can_join(n, heads.at(0), merged);
+            for (size_t i = 1; i < heads.size() && mergeable; i++)
+            {
+                for (auto input : m_graphs.at(heads.at(i)).m_inputs)
                 {
-                    arg_from_fusible_group = arg;
+                    mergeable = mergeable && is_valid_input(input, heads.at(0), merged);
                 }
-                else
+            }
+            if (mergeable)
+            {
+                merge_groups(heads);
+                return heads.at(0);
+            }
+        }
+
+        for (auto head : heads)
+        {
+            if (can_join(n, head, {head}))
+            {
+                return head;
+            }
+        }
+        return nullptr;
+    }
+
+    void merge_groups(const NodeVector& heads)
+    {
+        auto target_head = heads.at(0);
+        auto& target = m_graphs.at(target_head);
+        for (size_t i = 1; i < heads.size(); i++)
+        {
+            auto& source = m_graphs.at(heads.at(i));
+            for (auto member : source.m_nodes)
+            {
+                target.m_nodes.push_back(member);
+                m_heads[member] = target_head;
+            }
+            for (auto input : source.m_inputs)
+            {
+                if (std::find(target.m_inputs.begin(), target.m_inputs.end(), input) ==
+                    target.m_inputs.end())
+                {
+                    target.m_inputs.push_back(input);
+                }
+            }
+            m_graphs.erase(heads.at(i));
+        }
+
+        auto is_member = [this, target_head](const std::shared_ptr<Node>& input) {
+            return m_heads.count(input) != 0 && m_heads.at(input) == target_head;
+        };
+        target.m_inputs.erase(
+            std::remove_if(target.m_inputs.begin(), target.m_inputs.end(), is_member),
+            target.m_inputs.end());
+        // members have to stay in topological order
+        std::stable_sort(target.m_nodes.begin(),
+                         target.m_nodes.end(),
+                         [this](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
+                             return m_positions.at(a) < m_positions.at(b);
+                         });
+    }
+
+    void add_member(std::shared_ptr<Node> n, std::shared_ptr<Node> head)
+    {
+        auto& lkgraph = m_graphs.at(head);
+        for (auto arg : n->get_arguments())
+        {
+            if (is_splat(arg, n))
+            {
+                add_member(arg, head);
+            }
+            else if (m_heads.count(arg) == 0 || m_heads.at(arg) != head)
+            {
+                if (std::find(lkgraph.m_inputs.begin(), lkgraph.m_inputs.end(), arg) ==
+                    lkgraph.m_inputs.end())
                 {
-                    if (!is_leaf(arg) && m_heads.at(arg) != m_heads.at(arg_from_fusible_group))
-                    {
-                        return {nullptr};
-                    }
+                    lkgraph.m_inputs.push_back(arg);
                 }
             }
         }
-        return arg_from_fusible_group;
+        lkgraph.m_nodes.push_back(n);
+        m_heads.insert(std::make_pair(n, head));
+    }
+
+    void prune_graphs(size_t min_nodes_to_fuse)
+    {
+        for (auto it = m_graphs.begin(); it != m_graphs.end();)
+        {
+            if (it->second.m_nodes.size() < min_nodes_to_fuse)
+            {
+                it = m_graphs.erase(it);
+            }
+            else
+            {
+                it++;
+            }
+        }
+    }
+
+    void log_group(std::shared_ptr<Node> head) const
+    {
+        NGRAPH_DEBUG << "Group leader : " << head->get_name() << std::endl;
+        NGRAPH_DEBUG << "Group members : " << m_graphs.at(head).m_nodes << std::endl;
+        NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << std::endl;
     }
 
     std::unordered_map<std::shared_ptr<Node>, LKGraph> m_graphs;
     std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_heads;
+    std::unordered_map<std::shared_ptr<Node>, size_t> m_positions;
 };
 
 bool ngraph::runtime::cpu::pass::CPULoopKernelFusion::run_on_function(
@@ -199,8 +375,7 @@ bool ngraph::runtime::cpu::pass::CPULoopKernelFusion::run_on_function(
             auto& orig_output = outputs.at(i)->get_outputs().at(0);
 
             // this is needed since replace_output modifies orig_output.get_inputs()
-            std::set<ngraph::descriptor::Input*> inputs_copy{begin(orig_output.get_inputs()),
-                                                             end(orig_output.get_inputs())};
+            auto inputs_copy = orig_output.get_inputs();
             for (auto input : inputs_copy)
             {
                 // this user is NOT internal to this loop kernel
@@ -141,6 +141,7 @@ void ngraph::runtime::cpu::pass::LSTMFusion::construct_lstm_fprop()
     auto ht = std::make_shared<op::Multiply>(output_gate, tanh_2);
     auto ht_label = std::make_shared<pattern::op::Label>(ht, nullptr, NodeVector{ht});
 
+    bool marked_cells_only = m_marked_cells_only;
     // Define a call back that needs to called once the DFG matches the pattern
     pattern::graph_rewrite_callback callback = [ct_label,
                                                 input_xt,
@@ -149,10 +150,16 @@ void ngraph::runtime::cpu::pass::LSTMFusion::construct_lstm_fprop()
                                                 weights_h2h,
                                                 bias_i2h,
                                                 bias_h2h,
-                                                ct_1](pattern::Matcher& m) {
+                                                ct_1,
+                                                marked_cells_only](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In a callback for construct_fprop_lstm pattern against "
                      << m.get_match_root()->get_name();
 
+        if (marked_cells_only && !m.get_match_root()->is_fusable_rnn_cell())
+        {
+            return false;
+        }
+
         auto pattern_map = m.get_pattern_map();
         NGRAPH_DEBUG << "In Lstm fprop call back";
 
@@ -38,16 +38,24 @@ namespace ngraph
 class ngraph::runtime::cpu::pass::LSTMFusion : public ngraph::pass::GraphRewrite
 {
 public:
-    LSTMFusion()
+    /// \param marked_cells_only Only fuse the cells whose output a frontend marked with
+    ///    Node::set_fusable_rnn_cell(), leaving the rest of the graph untouched
+    LSTMFusion(bool marked_cells_only = false)
         : GraphRewrite()
+        , m_marked_cells_only(marked_cells_only)
     {
-        construct_sigmoid();
+        if (!marked_cells_only)
+        {
+            construct_sigmoid();
+        }
         construct_lstm_fprop();
     }
 
 private:
     void construct_sigmoid();
     void construct_lstm_fprop();
+
+    bool m_marked_cells_only;
 };
 
 class ngraph::runtime::cpu::pass::RNNFusion : public ngraph::pass::RecurrentGraphRewrite
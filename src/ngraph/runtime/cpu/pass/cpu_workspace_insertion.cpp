@@ -150,7 +150,7 @@ bool runtime::cpu::pass::CPUWorkspaceInsertion::transform(pattern::Matcher& m)
     // rewire users to use a new MaxPoolWithIndices (maxpool's output)
     for (auto& o : m_max_pool->get_outputs())
     {
-        std::set<ngraph::descriptor::Input*> copy{begin(o.get_inputs()), end(o.get_inputs())};
+        auto copy = o.get_inputs();
         for (auto i : copy)
         {
             i->replace_output(max_pool_with_indices_output->get_outputs().at(0));
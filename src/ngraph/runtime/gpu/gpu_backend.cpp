@@ -50,6 +50,11 @@ runtime::gpu::GPU_Backend::GPU_Backend()
 {
 }
 
+runtime::gpu::GPU_Backend::~GPU_Backend()
+{
+    wait_for_async_calls();
+}
+
 runtime::gpu::GPU_Backend::BackendContext::BackendContext()
     : m_runtime_context(new GPURuntimeContext)
     , m_primitive_emitter(new GPUPrimitiveEmitter(m_runtime_context))
@@ -39,6 +39,7 @@ namespace ngraph
             {
             public:
                 GPU_Backend();
+                ~GPU_Backend() override;
                 std::shared_ptr<ngraph::runtime::gpu::GPU_CallFrame> make_call_frame(
                     const std::shared_ptr<ngraph::runtime::gpu::GPU_ExternalFunction>&
                         external_function);
@@ -287,6 +287,7 @@ void runtime::gpu::GPU_ExternalFunction::emit_header()
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/gpu/cudnn_descriptors.hpp"
 #include "ngraph/runtime/gpu/gpu_cuda_kernel_ops.hpp"
@@ -650,9 +651,10 @@ void runtime::gpu::GPU_ExternalFunction::compile()
         .register_pass<ngraph::pass::AssignLayout<descriptor::layout::DenseTensorViewLayout>>();
 
     m_pass_manager.register_pass<runtime::gpu::pass::GPULayout>(this);
+    m_pass_manager.register_pass<ngraph::pass::MemorySchedule>();
     m_pass_manager.register_pass<ngraph::pass::Liveness>();
 
-    m_pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment);
+    m_pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, false, true);
 
     m_pass_manager.register_pass<runtime::gpu::pass::TensorMemoryReservation>(
         allocator, m_tensor_memory_buffers);
@@ -45,6 +45,7 @@ public:
 
     char* get_data_ptr();
     const char* get_data_ptr() const;
+    void* get_host_data_ptr() override { return get_data_ptr(); }
 
     template <typename T>
     T* get_data_ptr()
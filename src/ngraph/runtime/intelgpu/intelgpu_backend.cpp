@@ -204,6 +204,11 @@ runtime::intelgpu::IntelGPUBackend::IntelGPUBackend()
     ocl_engine = make_shared<cldnn::engine>();
 }
 
+runtime::intelgpu::IntelGPUBackend::~IntelGPUBackend()
+{
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::TensorView>
     runtime::intelgpu::IntelGPUBackend::create_tensor(const element::Type& element_type,
                                                       const Shape& shape)
@@ -39,6 +39,7 @@ class ngraph::runtime::intelgpu::IntelGPUBackend : public runtime::Backend
 {
 public:
     IntelGPUBackend();
+    ~IntelGPUBackend() override;
     std::shared_ptr<ngraph::runtime::TensorView>
         create_tensor(const ngraph::element::Type& element_type,
                       const Shape& shape,
@@ -46,6 +46,11 @@ extern "C" void delete_backend(runtime::Backend* backend)
     delete backend;
 }
 
+runtime::interpreter::INTBackend::~INTBackend()
+{
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::TensorView>
     runtime::interpreter::INTBackend::create_tensor(const element::Type& type, const Shape& shape)
 {
@@ -31,6 +31,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max.hpp"
 #include "ngraph/op/max_pool.hpp"
@@ -80,6 +81,7 @@
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_eq.hpp"
+#include "ngraph/runtime/reference/group_convolution.hpp"
 #include "ngraph/runtime/reference/less.hpp"
 #include "ngraph/runtime/reference/less_eq.hpp"
 #include "ngraph/runtime/reference/log.hpp"
@@ -140,6 +142,8 @@ namespace ngraph
 class ngraph::runtime::interpreter::INTBackend : public Backend
 {
 public:
+    ~INTBackend() override;
+
     std::shared_ptr<TensorView>
         create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
 
@@ -658,6 +662,23 @@ private:
                                      out[0]->get_element_count());
             break;
         }
+        case OP_TYPEID::GroupConvolution:
+        {
+            const op::GroupConvolution* c = static_cast<const op::GroupConvolution*>(&node);
+            reference::group_convolution<T>(args[0]->get_data_ptr<T>(),
+                                            args[1]->get_data_ptr<T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            args[0]->get_shape(),
+                                            args[1]->get_shape(),
+                                            out[0]->get_shape(),
+                                            c->get_window_movement_strides(),
+                                            c->get_window_dilation_strides(),
+                                            c->get_padding_below(),
+                                            c->get_padding_above(),
+                                            c->get_data_dilation_strides(),
+                                            c->get_groups());
+            break;
+        }
         case OP_TYPEID::Less:
         {
             reference::less<T>(args[0]->get_data_ptr<T>(),
@@ -16,9 +16,9 @@
 
 #pragma once
 
-#include <cmath>
+#include <algorithm>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -30,25 +30,24 @@ namespace ngraph
             void argmin(
                 const T* arg, U* out, const Shape& in_shape, const Shape& out_shape, size_t axis)
             {
-                // take the first elements (i.e. 0 indices) in out_shape - axis as minimums
-                memset(out, 0, shape_size(out_shape) * sizeof(U));
-
-                AxisVector av{axis};
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                size_t outer, extent, inner;
+                split_shape(in_shape, axis, outer, extent, inner);
+                for (size_t o = 0; o < outer; o++)
                 {
-                    Coordinate output_coord = project(input_coord, av);
-                    CoordinateTransform output_transform(out_shape);
-
-                    auto min_index = static_cast<size_t>(out[output_transform.index(output_coord)]);
-                    auto min_coord = input_coord;
-                    min_coord[axis] = min_index;
-                    if (arg[input_transform.index(input_coord)] <
-                        arg[input_transform.index(min_coord)])
+                    const T* in = arg + o * extent * inner;
+                    U* result = out + o * inner;
+                    // The first minimum along the axis wins
+                    std::fill(result, result + inner, U(0));
+                    for (size_t j = 1; j < extent; j++)
                     {
-                        out[output_transform.index(output_coord)] =
-                            static_cast<U>(input_coord[axis]);
+                        const T* row = in + j * inner;
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            if (row[i] < in[static_cast<size_t>(result[i]) * inner + i])
+                            {
+                                result[i] = static_cast<U>(j);
+                            }
+                        }
                     }
                 }
             }
@@ -16,9 +16,7 @@
 
 #pragma once
 
-#include <cmath>
-
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -33,16 +31,19 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = project(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                StridedLoop<2> loop(
+                    out_shape,
+                    {{row_major_strides(out_shape), projected_strides(out_shape, broadcast_axes)}});
+                size_t out_stride = loop.get_inner_stride(0);
+                size_t in_stride = loop.get_inner_stride(1);
+                loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    T* result = out + offsets[0];
+                    const T* in = arg + offsets[1];
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        result[i * out_stride] = in[i * in_stride];
+                    }
+                });
             }
         }
     }
@@ -16,11 +16,14 @@
 
 #pragma once
 
-#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
 
-#include "ngraph/axis_vector.hpp"
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/util.hpp"
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -55,150 +58,150 @@ namespace ngraph
                 // * output channel axes for filters is 0
                 // * output channel axis for output data is 1
                 // * rotate_filter is false
+                //
+                // Output element (N,chan_out,i_1,...,i_n) is the sum over input channels c and
+                // filter positions (f_1,...,f_n) of
+                //
+                //   arg0[N,c,p_1,...,p_n] * arg1[chan_out,c,f_1,...,f_n]
+                //
+                // where p_d = (s_d*i_d + l_d*f_d - below_d) / dilation_d is the position in the
+                // padded and dilated data batch. Positions in the padding or in a dilation gap
+                // contribute nothing, so each spatial axis is reduced up front to the ranges of
+                // (p_d, f_d) pairs, the taps, that read real data.
 
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (Coordinate out_coord : output_transform)
+                if (shape_size(out_shape) == 0)
                 {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (N,chan_out,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[batch_axis_result];
-                    size_t output_channel = out_coord[output_channel_axis_result];
-
-                    // For the input data we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,0,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,chans_in_count,s_1*i_1 + l_1*filter_dims_1,...,s_n*i_n + l_n*filter_dims_n)
-                    //
-                    // with strides:
-                    //
-                    //   (1,l_1,...,l_n).
-                    //
-                    // Note that we are iterating within the *padded* and *dilated* data batch, so further
-                    // down we must check the current coordinate is in the padding or dilation gap.
-
-                    size_t n_spatial_dimensions = arg0_shape.size() - 2;
-                    size_t n_input_channels = arg0_shape[input_channel_axis_data];
-
-                    Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-                    Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-                    Strides input_batch_transform_movement_strides(2 + n_spatial_dimensions, 1);
-                    CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions, 0);
-                    CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions, 0);
-                    Strides input_batch_transform_dilation_strides(2 + n_spatial_dimensions, 1);
-
-                    input_batch_transform_start[batch_axis_data] = batch_index;
-                    input_batch_transform_end[batch_axis_data] = batch_index + 1;
-                    input_batch_transform_start[input_channel_axis_data] = 0;
-                    input_batch_transform_end[input_channel_axis_data] = n_input_channels;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        size_t window_dilation_stride = window_dilation_strides[i - 2];
-                        size_t window_movement_stride = window_movement_strides[i - 2];
-                        std::ptrdiff_t below_pad = padding_below[i - 2];
-                        std::ptrdiff_t above_pad = padding_above[i - 2];
-                        size_t data_dilation_stride = data_dilation_strides[i - 2];
-
-                        input_batch_transform_start[i] = window_movement_stride * out_coord[i];
-                        input_batch_transform_end[i] =
-                            input_batch_transform_start[i] +
-                            (arg1_shape[i] - 1) * window_dilation_stride + 1;
-                        input_batch_transform_movement_strides[i] = window_dilation_stride;
-                        input_batch_transform_padding_below[i] = below_pad;
-                        input_batch_transform_padding_above[i] = above_pad;
-                        input_batch_transform_dilation_strides[i] = data_dilation_stride;
-                    }
-
-                    AxisVector input_batch_transform_axis_order(2 + n_spatial_dimensions);
-                    for (size_t i = 0; i < input_batch_transform_axis_order.size(); i++)
-                    {
-                        input_batch_transform_axis_order[i] = i;
-                    }
-
-                    CoordinateTransform input_batch_transform(
-                        arg0_shape,
-                        input_batch_transform_start,
-                        input_batch_transform_end,
-                        input_batch_transform_movement_strides,
-                        input_batch_transform_axis_order,
-                        input_batch_transform_padding_below,
-                        input_batch_transform_padding_above,
-                        input_batch_transform_dilation_strides);
-
-                    // Simultaneously with iterating I, for the filters we need to iterate the coordinate:
-                    //
-                    //   F
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (chan_out,0,0,...,0) -> (chan_out+1,chans_in_count,filter_dims_1,...,filter_dims_n)
-                    //
-                    // with unit stride.
-
-                    Shape filter_transform_start(2 + n_spatial_dimensions);
-                    Shape filter_transform_end(2 + n_spatial_dimensions);
+                    return;
+                }
 
-                    filter_transform_start[output_channel_axis_filters] = output_channel;
-                    filter_transform_end[output_channel_axis_filters] = output_channel + 1;
-                    filter_transform_start[input_channel_axis_filters] = 0;
-                    filter_transform_end[input_channel_axis_filters] = n_input_channels;
+                size_t n_spatial_dimensions = arg0_shape.size() - 2;
+                std::vector<size_t> arg0_strides = row_major_strides(arg0_shape);
+                std::vector<size_t> arg1_strides = row_major_strides(arg1_shape);
+                std::vector<size_t> out_strides = row_major_strides(out_shape);
 
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                // taps[d][tap_begin[d][i] .. tap_begin[d][i + 1]) hold the (arg0 offset, arg1
+                // offset) pairs along spatial axis d of output position i
+                std::vector<std::vector<std::pair<size_t, size_t>>> taps(n_spatial_dimensions);
+                std::vector<std::vector<size_t>> tap_begin(n_spatial_dimensions);
+                for (size_t d = 0; d < n_spatial_dimensions; d++)
+                {
+                    size_t axis = d + 2;
+                    std::ptrdiff_t data_dilation_stride = data_dilation_strides[d];
+                    std::ptrdiff_t dilated_extent =
+                        (static_cast<std::ptrdiff_t>(arg0_shape[axis]) - 1) *
+                            data_dilation_stride +
+                        1;
+                    for (size_t i = 0; i < out_shape[axis]; i++)
                     {
-                        filter_transform_start[i] = 0;
-                        filter_transform_end[i] = arg1_shape[i];
+                        tap_begin[d].push_back(taps[d].size());
+                        for (size_t f = 0; f < arg1_shape[axis]; f++)
+                        {
+                            std::ptrdiff_t padded_position =
+                                window_movement_strides[d] * i + window_dilation_strides[d] * f;
+                            std::ptrdiff_t position = padded_position - padding_below[d];
+                            if (position < 0 || position >= dilated_extent ||
+                                position % data_dilation_stride != 0)
+                            {
+                                continue;
+                            }
+                            size_t filter_position = (rotate_filter ? arg1_shape[axis] - f - 1 : f);
+                            taps[d].push_back(std::make_pair(
+                                (position / data_dilation_stride) * arg0_strides[axis],
+                                filter_position * arg1_strides[axis]));
+                        }
                     }
+                    tap_begin[d].push_back(taps[d].size());
+                }
 
-                    CoordinateTransform filter_transform(
-                        arg1_shape, filter_transform_start, filter_transform_end);
-
-                    // As we go, we sum up:
-                    //
-                    //   output[O] += arg0[I] * arg1[F].
-
-                    T result = 0;
+                size_t n_batches = out_shape[batch_axis_result];
+                size_t n_output_channels = out_shape[output_channel_axis_result];
+                size_t n_input_channels = arg0_shape[input_channel_axis_data];
+                size_t arg0_channel_stride = arg0_strides[input_channel_axis_data];
+                size_t arg1_channel_stride = arg1_strides[input_channel_axis_filters];
 
-                    CoordinateTransform::Iterator input_it = input_batch_transform.begin();
-                    CoordinateTransform::Iterator filter_it = filter_transform.begin();
+                // Odometers over the output's spatial positions and over the taps of one position
+                std::vector<size_t> out_position(n_spatial_dimensions);
+                std::vector<size_t> tap(n_spatial_dimensions);
+                std::vector<size_t> arg0_offsets(n_spatial_dimensions + 1);
+                std::vector<size_t> arg1_offsets(n_spatial_dimensions + 1);
 
-                    while (input_it != input_batch_transform.end() &&
-                           filter_it != filter_transform.end())
+                for (size_t batch = 0; batch < n_batches; batch++)
+                {
+                    for (size_t output_channel = 0; output_channel < n_output_channels;
+                         output_channel++)
                     {
-                        const Coordinate& input_batch_coord = *input_it;
-                        Coordinate filter_coord = *filter_it;
-
-                        if (rotate_filter)
+                        std::fill(out_position.begin(), out_position.end(), 0);
+                        bool more_positions = true;
+                        while (more_positions)
                         {
-                            Shape target_shape = filter_transform.get_target_shape();
-
-                            // Note that we only reverse the spatial dimensions here (loop
-                            // starts at 2)
-                            for (size_t i = 2; i < filter_coord.size(); i++)
+                            size_t out_index = batch * out_strides[batch_axis_result] +
+                                               output_channel *
+                                                   out_strides[output_channel_axis_result];
+                            bool has_taps = true;
+                            for (size_t d = 0; d < n_spatial_dimensions; d++)
                             {
-                                filter_coord[i] = target_shape[i] - filter_coord[i] - 1;
+                                out_index += out_position[d] * out_strides[d + 2];
+                                tap[d] = tap_begin[d][out_position[d]];
+                                has_taps &= (tap[d] < tap_begin[d][out_position[d] + 1]);
                             }
-                        }
-
-                        T v = input_batch_transform.has_source_coordinate(input_batch_coord)
-                                  ? arg0[input_batch_transform.index(input_batch_coord)]
-                                  : 0;
 
-                        result += v * arg1[filter_transform.index(filter_coord)];
+                            T result = 0;
+                            for (size_t c = 0; c < n_input_channels && has_taps; c++)
+                            {
+                                arg0_offsets[0] = batch * arg0_strides[batch_axis_data] +
+                                                  c * arg0_channel_stride;
+                                arg1_offsets[0] =
+                                    output_channel * arg1_strides[output_channel_axis_filters] +
+                                    c * arg1_channel_stride;
+                                for (size_t d = 0; d < n_spatial_dimensions; d++)
+                                {
+                                    tap[d] = tap_begin[d][out_position[d]];
+                                }
+                                // Walk the taps of every axis in row-major order
+                                size_t d = 0;
+                                while (true)
+                                {
+                                    for (; d < n_spatial_dimensions; d++)
+                                    {
+                                        arg0_offsets[d + 1] =
+                                            arg0_offsets[d] + taps[d][tap[d]].first;
+                                        arg1_offsets[d + 1] =
+                                            arg1_offsets[d] + taps[d][tap[d]].second;
+                                    }
+                                    result += arg0[arg0_offsets[n_spatial_dimensions]] *
+                                              arg1[arg1_offsets[n_spatial_dimensions]];
+
+                                    while (d > 0)
+                                    {
+                                        size_t position = out_position[d - 1];
+                                        if (++tap[d - 1] < tap_begin[d - 1][position + 1])
+                                        {
+                                            break;
+                                        }
+                                        tap[d - 1] = tap_begin[d - 1][position];
+                                        d--;
+                                    }
+                                    if (d == 0)
+                                    {
+                                        break;
+                                    }
+                                    d--;
+                                }
+                            }
+                            out[out_index] = result;
 
-                        ++input_it;
-                        ++filter_it;
+                            more_positions = false;
+                            for (size_t d = n_spatial_dimensions; d-- > 0;)
+                            {
+                                if (++out_position[d] < out_shape[d + 2])
+                                {
+                                    more_positions = true;
+                                    break;
+                                }
+                                out_position[d] = 0;
+                            }
+                        }
                     }
-
-                    out[output_transform.index(out_coord)] = result;
                 }
             }
         }
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename T>
+            void group_convolution(const T* arg0,
+                                   const T* arg1,
+                                   T* out,
+                                   const Shape& arg0_shape,
+                                   const Shape& arg1_shape,
+                                   const Shape& out_shape,
+                                   const Strides& window_movement_strides,
+                                   const Strides& window_dilation_strides,
+                                   const CoordinateDiff& padding_below,
+                                   const CoordinateDiff& padding_above,
+                                   const Strides& data_dilation_strides,
+                                   size_t groups)
+            {
+                // Data is [N, C_IN, ...], filters are [C_OUT, C_IN / groups, ...] and the result
+                // is [N, C_OUT, ...]. For a fixed batch item the data channels, filters and result
+                // channels of one group are contiguous, so every (item, group) pair is a plain
+                // convolution over sub-buffers.
+                Shape group_arg0_shape{arg0_shape};
+                group_arg0_shape.at(0) = 1;
+                group_arg0_shape.at(1) /= groups;
+                Shape group_arg1_shape{arg1_shape};
+                group_arg1_shape.at(0) /= groups;
+                Shape group_out_shape{out_shape};
+                group_out_shape.at(0) = 1;
+                group_out_shape.at(1) /= groups;
+
+                size_t group_arg0_size = shape_size(group_arg0_shape);
+                size_t group_arg1_size = shape_size(group_arg1_shape);
+                size_t group_out_size = shape_size(group_out_shape);
+
+                for (size_t batch = 0; batch < arg0_shape.at(0); ++batch)
+                {
+                    for (size_t group = 0; group < groups; ++group)
+                    {
+                        convolution<T>(arg0 + (batch * groups + group) * group_arg0_size,
+                                       arg1 + group * group_arg1_size,
+                                       out + (batch * groups + group) * group_out_size,
+                                       group_arg0_shape,
+                                       group_arg1_shape,
+                                       group_out_shape,
+                                       window_movement_strides,
+                                       window_dilation_strides,
+                                       padding_below,
+                                       padding_above,
+                                       data_dilation_strides,
+                                       0,
+                                       1,
+                                       1,
+                                       0,
+                                       0,
+                                       1,
+                                       false);
+                    }
+                }
+            }
+        }
+    }
+}
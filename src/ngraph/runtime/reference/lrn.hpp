@@ -16,11 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include <numeric>
 
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/util.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -41,28 +40,30 @@ namespace ngraph
                 T beta = static_cast<T>(dbeta);
                 T bias = static_cast<T>(dbias);
 
-                CoordinateTransform input_transform(arg_shape);
                 const size_t CHANNEL_DIM = 1;
-                const size_t MAX_C = arg_shape.at(CHANNEL_DIM);
-                for (const Coordinate& in_coord : input_transform)
+                size_t outer, channels, inner;
+                split_shape(arg_shape, CHANNEL_DIM, outer, channels, inner);
+                size_t half = (size - 1) / 2;
+                for (size_t n = 0; n < outer; n++)
                 {
-                    size_t c = in_coord.at(CHANNEL_DIM);
-                    T square_sum = 0;
-                    for (size_t i = c; i < c + size; i++)
+                    const T* batch = arg + n * channels * inner;
+                    for (size_t c = 0; c < channels; c++)
                     {
-                        if (i < (size - 1) / 2)
-                            continue;
-                        if (i >= MAX_C + (size - 1) / 2)
-                            continue;
-                        auto sum_coord = in_coord;
-                        sum_coord.at(CHANNEL_DIM) = i - (size - 1) / 2;
-                        square_sum += arg[input_transform.index(sum_coord)] *
-                                      arg[input_transform.index(sum_coord)];
+                        // Channels of the window around c that exist
+                        size_t first = std::max(c, half) - half;
+                        size_t last = std::min(c + size, channels + half) - half;
+                        const T* x = batch + c * inner;
+                        T* result = out + (n * channels + c) * inner;
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            T square_sum = 0;
+                            for (size_t j = first; j < last; j++)
+                            {
+                                square_sum += batch[j * inner + i] * batch[j * inner + i];
+                            }
+                            result[i] = x[i] / (std::pow(bias + (alpha / size) * square_sum, beta));
+                        }
                     }
-
-                    T x = arg[input_transform.index(in_coord)];
-                    out[input_transform.index(in_coord)] =
-                        x / (std::pow(bias + (alpha / size) * square_sum, beta));
                 }
             }
         }
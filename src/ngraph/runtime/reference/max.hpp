@@ -16,10 +16,10 @@
 
 #pragma once
 
-#include <cmath>
+#include <algorithm>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -38,26 +38,10 @@ namespace ngraph
                                ? -std::numeric_limits<T>::infinity()
                                : std::numeric_limits<T>::min();
 
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = project(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
-                    if (x > max)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                std::fill(out, out + shape_size(out_shape), minval);
+                reduce_axes(arg, out, in_shape, reduction_axes, [](T max, T x) -> T {
+                    return (x > max ? x : max);
+                });
             }
         }
     }
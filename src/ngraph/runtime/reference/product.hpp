@@ -16,9 +16,8 @@
 
 #pragma once
 
-#include <cmath>
-
-#include "ngraph/coordinate_transform.hpp"
+#include <algorithm>
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -33,22 +32,9 @@ namespace ngraph
                          const Shape& out_shape,
                          const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = project(input_coord, reduction_axes);
-
-                    out[output_transform.index(output_coord)] *=
-                        arg[input_transform.index(input_coord)];
-                }
+                std::fill(out, out + shape_size(out_shape), T(1));
+                reduce_axes(
+                    arg, out, in_shape, reduction_axes, [](T x, T y) -> T { return x * y; });
             }
         }
     }
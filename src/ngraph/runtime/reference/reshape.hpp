@@ -16,10 +16,8 @@
 
 #pragma once
 
-#include <cmath>
-
 #include "ngraph/axis_vector.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -34,26 +32,27 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
-                // Unfortunately we don't yet have a constructor for CoordinateTransform that lets us pass only source_space_shape
-                // and source_axis_order so we have to construct the defaults here.
-                Shape in_start_corner(in_shape.size(), 0); // (0,...0)
-                Strides in_strides(in_shape.size(), 1);    // (1,...,1)
-
-                CoordinateTransform input_transform(
-                    in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-
-                CoordinateTransform output_transform(out_shape);
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // Walk the input with its axes permuted and write the output in order
+                std::vector<size_t> in_strides = row_major_strides(in_shape);
+                Shape permuted_shape(in_shape.size());
+                std::vector<size_t> permuted_strides(in_shape.size());
+                for (size_t i = 0; i < in_axis_order.size(); i++)
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    permuted_shape[i] = in_shape[in_axis_order[i]];
+                    permuted_strides[i] = in_strides[in_axis_order[i]];
                 }
+
+                StridedLoop<2> loop(permuted_shape,
+                                    {{permuted_strides, row_major_strides(permuted_shape)}});
+                size_t in_stride = loop.get_inner_stride(0);
+                loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    const T* in = arg + offsets[0];
+                    T* result = out + offsets[1];
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        result[i] = in[i * in_stride];
+                    }
+                });
             }
         }
     }
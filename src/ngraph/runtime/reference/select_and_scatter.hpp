@@ -16,10 +16,12 @@
 
 #pragma once
 
-#include <cmath>
+#include <algorithm>
 #include <functional>
+#include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -41,76 +43,51 @@ namespace ngraph
                                     const Strides& window_movement_strides)
             {
                 // First write every element of the output with the supplied initial value.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
-                    out[output_transform.index(out_coord)] = *arg_init;
-                }
-
-                // Slide the window over selectee/output.
-                Shape window_start_corner_transform_start(arg_selectee_shape.size(), 0);
-                Shape window_start_corner_transform_end(arg_selectee_shape.size());
+                std::fill(out, out + shape_size(out_shape), *arg_init);
+
+                // Offsets of the elements of a window relative to its first element, in
+                // row-major order of the window
+                std::vector<size_t> selectee_strides = row_major_strides(arg_selectee_shape);
+                std::vector<size_t> window_offsets;
+                window_offsets.reserve(shape_size(window_shape));
+                StridedLoop<1> window_loop(window_shape, {{selectee_strides}});
+                size_t window_stride = window_loop.get_inner_stride(0);
+                window_loop([&](const StridedLoop<1>::Offsets& offsets, size_t count) {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        window_offsets.push_back(offsets[0] + i * window_stride);
+                    }
+                });
 
+                // Slide the window over selectee/output, one source element per window.
+                std::vector<size_t> window_start_strides(arg_selectee_shape.size());
                 for (size_t i = 0; i < arg_selectee_shape.size(); i++)
                 {
-                    window_start_corner_transform_end[i] =
-                        arg_selectee_shape[i] - window_shape[i] + 1;
+                    window_start_strides[i] = selectee_strides[i] * window_movement_strides[i];
                 }
-
-                CoordinateTransform window_start_corner_transform(
-                    arg_selectee_shape,
-                    window_start_corner_transform_start,
-                    window_start_corner_transform_end,
-                    window_movement_strides);
-
-                CoordinateTransform source_transform(arg_source_shape);
-                CoordinateTransform::Iterator source_it = source_transform.begin();
-
-                for (Coordinate window_start_coord : window_start_corner_transform)
-                {
-                    // We need a physical rather than virtual coordinate to start the window.
-                    window_start_coord =
-                        window_start_corner_transform.to_source_coordinate(window_start_coord);
-
-                    Shape window_transform_end(arg_selectee_shape.size());
-                    for (size_t i = 0; i < arg_selectee_shape.size(); i++)
+                StridedLoop<2> source_loop(
+                    arg_source_shape,
+                    {{window_start_strides, row_major_strides(arg_source_shape)}});
+                size_t start_stride = source_loop.get_inner_stride(0);
+                source_loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    for (size_t i = 0; i < count; i++)
                     {
-                        window_transform_end[i] = window_start_coord[i] + window_shape[i];
-                    }
-
-                    CoordinateTransform window_transform(
-                        arg_selectee_shape, window_start_coord, window_transform_end);
-
-                    bool first_val = true;
-                    Coordinate winner_coord;
-
-                    // This initial value is ignored; it's just here so the compiler knows
-                    // for sure that winner_val is initialized.
-                    T winner_val = 0;
-
-                    for (const Coordinate& challenger_coord : window_transform)
-                    {
-                        T challenger_val = arg_selectee[window_transform.index(challenger_coord)];
-
-                        if (first_val || selection_function(challenger_val, winner_val))
+                        size_t window_start = offsets[0] + i * start_stride;
+                        size_t winner = window_start + window_offsets.at(0);
+                        T winner_val = arg_selectee[winner];
+                        for (size_t j = 1; j < window_offsets.size(); j++)
                         {
-                            winner_coord = challenger_coord;
-                            winner_val = challenger_val;
-                            first_val = false;
+                            size_t challenger = window_start + window_offsets[j];
+                            T challenger_val = arg_selectee[challenger];
+                            if (selection_function(challenger_val, winner_val))
+                            {
+                                winner = challenger;
+                                winner_val = challenger_val;
+                            }
                         }
+                        out[winner] = scatter_function(out[winner], arg_source[offsets[1] + i]);
                     }
-
-                    Coordinate source_coord = *source_it;
-
-                    T old_output_val = out[window_transform.index(winner_coord)];
-                    T source_val = arg_source[source_transform.index(source_coord)];
-                    T new_output_val = scatter_function(old_output_val, source_val);
-
-                    out[window_transform.index(winner_coord)] = new_output_val;
-
-                    ++source_it;
-                }
+                });
             }
         }
     }
@@ -16,9 +16,9 @@
 
 #pragma once
 
-#include <cmath>
-
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -35,19 +35,25 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& in_coord : input_transform)
+                std::vector<size_t> arg_strides = row_major_strides(arg_shape);
+                std::vector<size_t> in_strides(arg_shape.size());
+                size_t in_offset = 0;
+                for (size_t i = 0; i < arg_shape.size(); i++)
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
+                    in_offset += lower_bounds[i] * arg_strides[i];
+                    in_strides[i] = strides[i] * arg_strides[i];
                 }
+
+                StridedLoop<2> loop(out_shape, {{in_strides, row_major_strides(out_shape)}});
+                size_t in_stride = loop.get_inner_stride(0);
+                loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    const T* in = arg + in_offset + offsets[0];
+                    T* result = out + offsets[1];
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        result[i] = in[i * in_stride];
+                    }
+                });
             }
         }
     }
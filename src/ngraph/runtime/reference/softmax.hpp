@@ -17,8 +17,11 @@
 #pragma once
 
 #include <cmath>
-#include "ngraph/coordinate_transform.hpp"
+#include <vector>
+
+#include "ngraph/coordinate.hpp"
 #include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 
 namespace ngraph
@@ -31,30 +34,33 @@ namespace ngraph
             void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
             {
                 auto temp_shape = project(shape, axes);
-                auto temp_elements = std::accumulate(
-                    temp_shape.begin(), temp_shape.end(), 1, std::multiplies<size_t>());
-                auto temp_ptr = new T[temp_elements];
-
-                max(arg, temp_ptr, shape, temp_shape, axes);
-
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = project(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
-                }
-
-                sum(out, temp_ptr, shape, temp_shape, axes);
-
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = project(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
-                }
-
-                delete[] temp_ptr;
+                std::vector<T> temp(shape_size(temp_shape));
+
+                max(arg, temp.data(), shape, temp_shape, axes);
+
+                StridedLoop<2> loop(
+                    shape, {{row_major_strides(shape), projected_strides(shape, axes)}});
+                size_t temp_stride = loop.get_inner_stride(1);
+                loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    const T* in = arg + offsets[0];
+                    T* result = out + offsets[0];
+                    const T* max_value = temp.data() + offsets[1];
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        result[i] = std::exp(in[i] - max_value[i * temp_stride]);
+                    }
+                });
+
+                sum(out, temp.data(), shape, temp_shape, axes);
+
+                loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    T* result = out + offsets[0];
+                    const T* sum_value = temp.data() + offsets[1];
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        result[i] /= sum_value[i * temp_stride];
+                    }
+                });
             }
         }
     }
@@ -0,0 +1,219 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Walks the elements of a shape in row-major order for N operands at once.
+            ///
+            /// Operand k addresses the element at coordinate c with offset
+            /// sum(c[i] * strides[k][i]); a stride of 0 repeats the operand along an axis. Axes of
+            /// extent 1 are dropped and neighbouring axes that are contiguous in every operand are
+            /// merged, so the kernel is called once per run of the innermost remaining axis with
+            /// the offsets of the run's first element. Nothing is allocated per element.
+            template <size_t N>
+            class StridedLoop
+            {
+            public:
+                using Offsets = std::array<size_t, N>;
+
+                StridedLoop(const Shape& shape, const std::array<std::vector<size_t>, N>& strides)
+                    : m_empty(false)
+                {
+                    for (size_t axis = 0; axis < shape.size(); axis++)
+                    {
+                        if (shape[axis] == 0)
+                        {
+                            m_empty = true;
+                        }
+                        if (shape[axis] <= 1)
+                        {
+                            continue;
+                        }
+                        bool merge = !m_shape.empty();
+                        for (size_t k = 0; k < N && merge; k++)
+                        {
+                            merge = (m_strides[k].back() == strides[k][axis] * shape[axis]);
+                        }
+                        if (merge)
+                        {
+                            m_shape.back() *= shape[axis];
+                            for (size_t k = 0; k < N; k++)
+                            {
+                                m_strides[k].back() = strides[k][axis];
+                            }
+                        }
+                        else
+                        {
+                            m_shape.push_back(shape[axis]);
+                            for (size_t k = 0; k < N; k++)
+                            {
+                                m_strides[k].push_back(strides[k][axis]);
+                            }
+                        }
+                    }
+                    if (m_shape.empty())
+                    {
+                        m_shape.push_back(1);
+                        for (size_t k = 0; k < N; k++)
+                        {
+                            m_strides[k].push_back(0);
+                        }
+                    }
+                }
+
+                /// Stride of operand k along the innermost axis, i.e. within a run
+                size_t get_inner_stride(size_t k) const { return m_strides[k].back(); }
+                /// \brief Calls kernel(offsets, count) for every run of count elements
+                template <typename KERNEL>
+                void operator()(KERNEL kernel) const
+                {
+                    if (m_empty)
+                    {
+                        return;
+                    }
+                    size_t outer_rank = m_shape.size() - 1;
+                    size_t count = m_shape.back();
+                    std::vector<size_t> counter(outer_rank, 0);
+                    Offsets offsets;
+                    offsets.fill(0);
+                    while (true)
+                    {
+                        kernel(offsets, count);
+
+                        // Step the outer axes like an odometer
+                        size_t axis = outer_rank;
+                        while (true)
+                        {
+                            if (axis == 0)
+                            {
+                                return;
+                            }
+                            axis--;
+                            if (++counter[axis] < m_shape[axis])
+                            {
+                                for (size_t k = 0; k < N; k++)
+                                {
+                                    offsets[k] += m_strides[k][axis];
+                                }
+                                break;
+                            }
+                            counter[axis] = 0;
+                            for (size_t k = 0; k < N; k++)
+                            {
+                                offsets[k] -= m_strides[k][axis] * (m_shape[axis] - 1);
+                            }
+                        }
+                    }
+                }
+
+            private:
+                Shape m_shape;
+                std::array<std::vector<size_t>, N> m_strides;
+                bool m_empty;
+            };
+
+            /// \brief Strides of the tensor obtained by deleting `deleted_axes` from `shape`,
+            ///     expressed along the axes of `shape`; deleted axes get a stride of 0.
+            inline std::vector<size_t> projected_strides(const Shape& shape,
+                                                         const AxisSet& deleted_axes)
+            {
+                std::vector<size_t> strides(shape.size(), 0);
+                size_t stride = 1;
+                for (size_t i = shape.size(); i-- > 0;)
+                {
+                    if (deleted_axes.count(i) == 0)
+                    {
+                        strides[i] = stride;
+                        stride *= shape[i];
+                    }
+                }
+                return strides;
+            }
+
+            /// \brief Folds every element of arg into the element of out at its coordinate with
+            ///     `reduction_axes` deleted, out[j] = reduce(out[j], arg[i]), in row-major order of
+            ///     arg. out must be initialized.
+            template <typename T, typename REDUCE>
+            void reduce_axes(const T* arg,
+                             T* out,
+                             const Shape& in_shape,
+                             const AxisSet& reduction_axes,
+                             REDUCE reduce)
+            {
+                StridedLoop<2> loop(
+                    in_shape,
+                    {{row_major_strides(in_shape), projected_strides(in_shape, reduction_axes)}});
+                size_t in_stride = loop.get_inner_stride(0);
+                size_t out_stride = loop.get_inner_stride(1);
+                loop([&](const StridedLoop<2>::Offsets& offsets, size_t count) {
+                    const T* in = arg + offsets[0];
+                    T* result = out + offsets[1];
+                    if (out_stride == 0)
+                    {
+                        T value = *result;
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            value = reduce(value, in[i * in_stride]);
+                        }
+                        *result = value;
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            T& value = result[i * out_stride];
+                            value = reduce(value, in[i * in_stride]);
+                        }
+                    }
+                });
+            }
+
+            /// \brief Splits `shape` around `axis` into the element counts before it, along it
+            ///     and after it, the last being the stride of `axis`.
+            inline void split_shape(const Shape& shape,
+                                    size_t axis,
+                                    size_t& outer,
+                                    size_t& extent,
+                                    size_t& inner)
+            {
+                outer = 1;
+                for (size_t i = 0; i < axis; i++)
+                {
+                    outer *= shape[i];
+                }
+                extent = shape.at(axis);
+                inner = 1;
+                for (size_t i = axis + 1; i < shape.size(); i++)
+                {
+                    inner *= shape[i];
+                }
+            }
+        }
+    }
+}
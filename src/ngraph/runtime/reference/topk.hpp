@@ -17,10 +17,10 @@
 #pragma once
 
 #include <algorithm>
-#include <cmath>
-#include <numeric>
+#include <tuple>
+#include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -39,54 +39,43 @@ namespace ngraph
                       bool compute_max)
             {
                 using namespace std;
-                // reorder source axis visit order and make "axis" inner most
-                size_t ndim = static_cast<size_t>(in_shape.size());
-                Coordinate start_corner(ndim, 0);
-                Coordinate end_corner(in_shape);
-                end_corner[axis] = 1;
-                Strides strides(ndim, 1);
-                AxisVector axis_order(ndim);
-                iota(axis_order.begin(), axis_order.end(), 0);
-                axis_order.erase(axis_order.begin() + axis);
-                axis_order.push_back(axis);
-                // Create CoordinateTransforms that visits only the first element along "axis"
-                CoordinateTransform input_transform(
-                    in_shape, start_corner, end_corner, strides, axis_order);
-                CoordinateTransform output_transform(
-                    out_shape, start_corner, end_corner, strides, axis_order);
-                // Create temp vector for sorting.
-                vector<tuple<T, U>> workspace(in_shape[axis]);
-                vector<size_t> in_strides = ngraph::row_major_strides(in_shape);
-                vector<size_t> out_strides = ngraph::row_major_strides(out_shape);
-                auto in_axis_stride = in_strides[axis];
-                auto out_axis_stride = out_strides[axis];
-                for (const Coordinate& coord : input_transform)
+                size_t outer, extent, inner;
+                split_shape(in_shape, axis, outer, extent, inner);
+                size_t out_extent = out_shape.at(axis);
+                // Temp vector for sorting, reused for every slice along the axis
+                vector<tuple<T, U>> workspace(extent);
+                auto greater = [](const tuple<T, U>& a, const tuple<T, U>& b) -> bool {
+                    return a > b;
+                };
+                auto less = [](const tuple<T, U>& a, const tuple<T, U>& b) -> bool {
+                    return a < b;
+                };
+                for (size_t o = 0; o < outer; o++)
                 {
-                    auto arg_index = input_transform.index(coord);
-                    auto out_index = output_transform.index(coord);
-                    // Fill the temp vector
-                    U i = 0;
-                    for (tuple<T, U>& entry : workspace)
+                    for (size_t i = 0; i < inner; i++)
                     {
-                        get<0>(entry) = arg[arg_index];
-                        get<1>(entry) = i;
-                        arg_index += in_axis_stride;
-                        i++;
-                    }
-                    // Sort the temp vector
-                    sort(
-                        workspace.begin(),
-                        workspace.end(),
-                        compute_max
-                        ? [](const tuple<T, U>& a, const tuple<T, U>& b) -> bool { return a > b; }
-                        : [](const tuple<T, U>& a, const tuple<T, U>& b) -> bool { return a < b; });
-                    // Write temp vector to output
-                    for (size_t j = 0; j < k; j++)
-                    {
-                        tuple<T, U> entry = workspace[j];
-                        out_values[out_index] = get<0>(entry);
-                        out_indices[out_index] = get<1>(entry);
-                        out_index += out_axis_stride;
+                        const T* in = arg + o * extent * inner + i;
+                        for (size_t j = 0; j < extent; j++)
+                        {
+                            workspace[j] = make_tuple(in[j * inner], static_cast<U>(j));
+                        }
+                        if (compute_max)
+                        {
+                            partial_sort(
+                                workspace.begin(), workspace.begin() + k, workspace.end(), greater);
+                        }
+                        else
+                        {
+                            partial_sort(
+                                workspace.begin(), workspace.begin() + k, workspace.end(), less);
+                        }
+                        size_t out_index = o * out_extent * inner + i;
+                        for (size_t j = 0; j < k; j++)
+                        {
+                            out_values[out_index] = get<0>(workspace[j]);
+                            out_indices[out_index] = get<1>(workspace[j]);
+                            out_index += inner;
+                        }
                     }
                 }
             }
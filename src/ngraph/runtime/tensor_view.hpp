@@ -58,6 +58,11 @@ namespace ngraph
             std::shared_ptr<ngraph::descriptor::layout::TensorViewLayout>
                 get_tensor_view_layout() const;
 
+            /// \brief Host memory holding the tensor's elements in row-major order
+            /// \return The memory, or nullptr if the data is on a device or in another layout,
+            ///         in which case it is only accessible through read() and write()
+            virtual void* get_host_data_ptr() { return nullptr; }
+
             bool get_stale() { return m_stale; }
             void set_stale(bool val) { m_stale = val; }
             /// \brief Write bytes directly into the tensor
@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <functional>
 
+#include "ngraph/constant_store.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -48,6 +51,7 @@
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/less.hpp"
 #include "ngraph/op/less_eq.hpp"
 #include "ngraph/op/log.hpp"
@@ -106,10 +110,26 @@ T get_or_default(nlohmann::json& j, const std::string& key, const T& default_val
     return j.count(key) != 0 ? j.at(key).get<T>() : default_value;
 }
 
+// Produces the json of the next node of a function, false once there are no more
+using node_source_t = bool(json&);
+
 static std::shared_ptr<ngraph::Function>
     read_function(const json&,
                   std::unordered_map<std::string, std::shared_ptr<Function>>&,
                   function<const_data_callback_t>);
+static std::shared_ptr<ngraph::Function>
+    read_function(const std::string& func_name,
+                  const std::vector<std::string>& func_parameters,
+                  const std::vector<std::string>& func_result,
+                  function<node_source_t> next_node,
+                  std::unordered_map<std::string, std::shared_ptr<Function>>&,
+                  function<const_data_callback_t>);
+
+static std::shared_ptr<ngraph::Function> read_functions(const json&,
+                                                       function<const_data_callback_t>);
+static std::shared_ptr<ngraph::Function> deserialize_mapped_cpio(const string& path);
+static bool is_binary_graph(istream& in);
+static std::shared_ptr<ngraph::Function> deserialize_binary(istream& in);
 
 static json write(const ngraph::Function&, bool binary_constant_data);
 static json write(const ngraph::Node&, bool binary_constant_data);
@@ -172,7 +192,8 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
             {
                 uint32_t size = static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
                                                       c->get_output_element_type(0).size());
-                writer.write(c->get_name(), c->get_data_ptr(), size);
+                // aligned so that deserialize() can use the data in place in a mapped file
+                writer.write(c->get_name(), c->get_data_ptr(), size, ConstantStore::s_alignment);
             }
         });
     });
@@ -212,42 +233,36 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (is_binary_graph(in))
+    {
+        rc = deserialize_binary(in);
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
         if (file_info.size() > 0)
         {
             // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
+            string jstr(file_info[0].get_size(), '\0');
+            reader.read(file_info[0].get_name(), &jstr[0], jstr.size());
             json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
-                        {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                free(const_data);
-                                break;
-                            }
-                        }
-                        return const_node;
-                    });
-                rc = f;
-            }
+            rc = read_functions(
+                js, [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                    shared_ptr<Node> const_node;
+                    if (const cpio::FileInfo* info = reader.find(const_name))
+                    {
+                        // read straight into the buffer the constant will own
+                        size_t size = info->get_size();
+                        void* const_data = aligned_alloc(
+                            ConstantStore::s_alignment,
+                            round_up(max<size_t>(size, 1), ConstantStore::s_alignment));
+                        reader.read(const_name, const_data, size);
+                        const_node = make_shared<op::Constant>(
+                            et, shape, ConstantStore::get_default().adopt(const_data, size));
+                    }
+                    return const_node;
+                });
         }
     }
     else
@@ -266,23 +281,404 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (cpio::is_cpio(s))
+        {
+            rc = deserialize_mapped_cpio(s);
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            rc = deserialize(in);
+        }
     }
     else
     {
         json js = json::parse(s);
+        rc = read_functions(js, nullptr);
+    }
+
+    return rc;
+}
+
+// Maps the archive once; the model json is parsed in place and constants point at their data
+// in the mapping, so nothing is read until it is used and the pages are shared with every
+// process loading the same file. The file must not be modified while the Function is alive.
+static shared_ptr<ngraph::Function> deserialize_mapped_cpio(const string& path)
+{
+    shared_ptr<Function> rc;
+    ifstream in(path, ios_base::binary | ios_base::in);
+    cpio::Reader reader(in);
+    const vector<cpio::FileInfo>& file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        auto archive = ConstantStore::get_default().map_file(path);
+        const char* base = static_cast<const char*>(archive->get_ptr());
+        // The first file is the model
+        const char* model = base + file_info[0].get_offset();
+        json js = json::parse(model, model + file_info[0].get_size());
+        rc = read_functions(
+            js, [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<Node> const_node;
+                if (const cpio::FileInfo* info = reader.find(const_name))
+                {
+                    shared_ptr<const ConstantStore::Buffer> buffer;
+                    // Archives written before constants were aligned only align file data to
+                    // two bytes
+                    if (info->get_offset() % et.size() == 0)
+                    {
+                        buffer = ConstantStore::get_default().slice(
+                            archive, info->get_offset(), info->get_size());
+                    }
+                    else
+                    {
+                        buffer = ConstantStore::get_default().intern(base + info->get_offset(),
+                                                                     info->get_size());
+                    }
+                    const_node = make_shared<op::Constant>(et, shape, buffer);
+                }
+                return const_node;
+            });
+    }
+    return rc;
+}
+
+static shared_ptr<ngraph::Function> read_functions(const json& js,
+                                                   function<const_data_callback_t> const_data)
+{
+    shared_ptr<Function> rc;
+    unordered_map<string, shared_ptr<Function>> function_map;
+    for (const json& func : js)
+    {
+        rc = read_function(func, function_map, const_data);
+    }
+    return rc;
+}
+
+// Binary graph format
+//
+// A stream of records following an 8 byte header ("NGBG" and a version), all integers
+// little-endian:
+//   'S' len:u32 bytes           appends a string to the string table
+//   'F' name:u32 n:u32 param:u32*n n:u32 result:u32*n nodes:u32
+//                               starts a function; names are string table indices
+//   'N' op:u32 name:u32 n:u32 input:u32*n len:u32 attributes
+//                               a node, its inputs are indices of earlier nodes of the
+//                               function and its attributes the CBOR of its json form.
+//                               Constants follow with size:u64, zero padding up to a
+//                               multiple of 64 bytes from the start of the stream, and data
+//   'E'                         end of the graph
+// Functions are written callees first and nodes in topological order, so both sides only
+// ever hold one node's record.
+static const char s_binary_graph_magic[4] = {'N', 'G', 'B', 'G'};
+static const uint32_t s_binary_graph_version = 1;
+static const size_t s_binary_constant_alignment = ConstantStore::s_alignment;
+
+class BinaryGraphWriter
+{
+public:
+    BinaryGraphWriter(ostream& out)
+        : m_out(out)
+    {
+        write_bytes(s_binary_graph_magic, sizeof(s_binary_graph_magic));
+        write_u32(s_binary_graph_version);
+    }
+
+    void write_function(const Function& f)
+    {
+        auto ops = const_cast<Function&>(f).get_ordered_ops();
+        unordered_map<const Node*, uint32_t> node_index;
+        vector<uint32_t> parameters;
+        for (auto& parameter : f.get_parameters())
+        {
+            parameters.push_back(intern(parameter->get_name()));
+        }
+        vector<uint32_t> results;
+        for (size_t i = 0; i < f.get_output_size(); ++i)
+        {
+            results.push_back(intern(f.get_output_op(i)->get_name()));
+        }
+        uint32_t name = intern(f.get_name());
+
+        write_tag('F');
+        write_u32(name);
+        write_u32(static_cast<uint32_t>(parameters.size()));
+        for (uint32_t parameter : parameters)
+        {
+            write_u32(parameter);
+        }
+        write_u32(static_cast<uint32_t>(results.size()));
+        for (uint32_t result : results)
+        {
+            write_u32(result);
+        }
+        write_u32(static_cast<uint32_t>(ops.size()));
+
+        for (auto& node : ops)
+        {
+            json attributes = write(*node, true);
+            for (auto key : {"name", "op", "inputs", "outputs"})
+            {
+                attributes.erase(key);
+            }
+            vector<uint8_t> blob = json::to_cbor(attributes);
+            uint32_t op_name = intern(node->description());
+            uint32_t node_name = intern(node->get_name());
+
+            write_tag('N');
+            write_u32(op_name);
+            write_u32(node_name);
+            write_u32(static_cast<uint32_t>(node->get_input_size()));
+            for (auto& input : node->get_inputs())
+            {
+                write_u32(node_index.at(input.get_output().get_node().get()));
+            }
+            write_u32(static_cast<uint32_t>(blob.size()));
+            write_bytes(blob.data(), blob.size());
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                uint64_t size = shape_size(c->get_shape()) * c->get_element_type().size();
+                write_u64(size);
+                static const char padding[s_binary_constant_alignment] = {};
+                write_bytes(padding, round_up(m_offset, s_binary_constant_alignment) - m_offset);
+                write_bytes(c->get_data_ptr(), size);
+            }
+            uint32_t index = static_cast<uint32_t>(node_index.size());
+            node_index[node.get()] = index;
+        }
+    }
+
+    void close() { write_tag('E'); }
+private:
+    uint32_t intern(const string& s)
+    {
+        auto it = m_strings.find(s);
+        if (it != m_strings.end())
+        {
+            return it->second;
+        }
+        write_tag('S');
+        write_u32(static_cast<uint32_t>(s.size()));
+        write_bytes(s.data(), s.size());
+        uint32_t index = static_cast<uint32_t>(m_strings.size());
+        m_strings[s] = index;
+        return index;
+    }
+
+    void write_tag(char tag) { write_bytes(&tag, 1); }
+    void write_u32(uint32_t value)
+    {
+        uint8_t bytes[4];
+        for (size_t i = 0; i < sizeof(bytes); i++)
+        {
+            bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+        write_bytes(bytes, sizeof(bytes));
+    }
+    void write_u64(uint64_t value)
+    {
+        write_u32(static_cast<uint32_t>(value));
+        write_u32(static_cast<uint32_t>(value >> 32));
+    }
+    void write_bytes(const void* data, size_t size)
+    {
+        m_out.write(static_cast<const char*>(data), size);
+        m_offset += size;
+    }
+
+    ostream& m_out;
+    size_t m_offset = 0;
+    unordered_map<string, uint32_t> m_strings;
+};
+
+class BinaryGraphReader
+{
+public:
+    BinaryGraphReader(istream& in)
+        : m_in(in)
+    {
+        char magic[sizeof(s_binary_graph_magic)];
+        read_bytes(magic, sizeof(magic));
+        if (memcmp(magic, s_binary_graph_magic, sizeof(magic)) != 0)
+        {
+            throw ngraph_error("Not a binary graph");
+        }
+        uint32_t version = read_u32();
+        if (version != s_binary_graph_version)
+        {
+            throw ngraph_error("Unsupported binary graph version " + to_string(version));
+        }
+    }
+
+    shared_ptr<Function> read()
+    {
+        shared_ptr<Function> rc;
         unordered_map<string, shared_ptr<Function>> function_map;
-        for (json func : js)
+        for (char tag = read_tag(); tag != 'E'; tag = read_tag())
+        {
+            if (tag != 'F')
+            {
+                throw ngraph_error("Malformed binary graph, expected a function");
+            }
+            string name = get_string(read_u32());
+            vector<string> parameters(read_u32());
+            for (string& parameter : parameters)
+            {
+                parameter = get_string(read_u32());
+            }
+            vector<string> results(read_u32());
+            for (string& result : results)
+            {
+                result = get_string(read_u32());
+            }
+            size_t node_count = read_u32();
+
+            vector<string> node_names;
+            shared_ptr<const ConstantStore::Buffer> constant_data;
+            rc = read_function(
+                name,
+                parameters,
+                results,
+                [&](json& node_js) {
+                    if (node_names.size() == node_count)
+                    {
+                        return false;
+                    }
+                    if (read_tag() != 'N')
+                    {
+                        throw ngraph_error("Malformed binary graph, expected a node");
+                    }
+                    string op_name = get_string(read_u32());
+                    string node_name = get_string(read_u32());
+                    json inputs = json::array();
+                    for (size_t i = read_u32(); i > 0; i--)
+                    {
+                        inputs.push_back(node_names.at(read_u32()));
+                    }
+                    vector<uint8_t> blob(read_u32());
+                    read_bytes(blob.data(), blob.size());
+                    node_js = json::from_cbor(blob);
+                    node_js["name"] = node_name;
+                    node_js["op"] = op_name;
+                    node_js["inputs"] = inputs;
+                    node_js["outputs"] = json::array();
+                    if (op_name == "Constant")
+                    {
+                        size_t size = read_u64();
+                        skip(round_up(m_offset, s_binary_constant_alignment) - m_offset);
+                        void* data = ngraph::aligned_alloc(
+                            ConstantStore::s_alignment,
+                            round_up(max<size_t>(size, 1), ConstantStore::s_alignment));
+                        try
+                        {
+                            read_bytes(data, size);
+                        }
+                        catch (...)
+                        {
+                            aligned_free(data);
+                            throw;
+                        }
+                        constant_data = ConstantStore::get_default().adopt(data, size);
+                    }
+                    node_names.push_back(node_name);
+                    return true;
+                },
+                function_map,
+                [&](const string&, const element::Type& et, const Shape& shape) {
+                    return make_shared<op::Constant>(et, shape, constant_data);
+                });
+        }
+        return rc;
+    }
+
+private:
+    const string& get_string(uint32_t index) { return m_strings.at(index); }
+    char read_tag()
+    {
+        char tag;
+        read_bytes(&tag, 1);
+        // strings are defined right before the record that first uses them
+        while (tag == 'S')
+        {
+            string s(read_u32(), '\0');
+            read_bytes(&s[0], s.size());
+            m_strings.push_back(s);
+            read_bytes(&tag, 1);
+        }
+        return tag;
+    }
+    uint32_t read_u32()
+    {
+        uint8_t bytes[4];
+        read_bytes(bytes, sizeof(bytes));
+        uint32_t value = 0;
+        for (size_t i = 0; i < sizeof(bytes); i++)
+        {
+            value |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+        }
+        return value;
+    }
+    uint64_t read_u64()
+    {
+        uint64_t low = read_u32();
+        uint64_t high = read_u32();
+        return low | (high << 32);
+    }
+    void skip(size_t size)
+    {
+        m_in.ignore(size);
+        m_offset += size;
+    }
+    void read_bytes(void* data, size_t size)
+    {
+        if (!m_in.read(static_cast<char*>(data), size))
         {
-            shared_ptr<Function> f = read_function(func, function_map, nullptr);
-            rc = f;
+            throw ngraph_error("Unexpected end of binary graph");
         }
+        m_offset += size;
     }
 
+    istream& m_in;
+    size_t m_offset = 0;
+    vector<string> m_strings;
+};
+
+static bool is_binary_graph(istream& in)
+{
+    char magic[sizeof(s_binary_graph_magic)];
+    auto start = in.tellg();
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) &&
+              memcmp(magic, s_binary_graph_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(start);
     return rc;
 }
 
+static shared_ptr<ngraph::Function> deserialize_binary(istream& in)
+{
+    BinaryGraphReader reader(in);
+    return reader.read();
+}
+
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    vector<shared_ptr<Function>> functions;
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) { functions.push_back(f); });
+    BinaryGraphWriter writer(out);
+    // callees before callers, as in the json
+    for (auto it = functions.rbegin(); it != functions.rend(); it++)
+    {
+        writer.write_function(**it);
+    }
+    writer.close();
+}
+
 static json write(const Function& f, bool binary_constant_data)
 {
     json function;
@@ -348,14 +744,37 @@ static shared_ptr<ngraph::Function>
     read_function(const json& func_js,
                   unordered_map<string, shared_ptr<Function>>& function_map,
                   function<const_data_callback_t> const_data_callback)
+{
+    const json& ops = func_js.at("ops");
+    auto next_op = ops.begin();
+    return read_function(func_js.at("name").get<string>(),
+                         func_js.at("parameters").get<vector<string>>(),
+                         func_js.at("result").get<vector<string>>(),
+                         [&](json& node_js) {
+                             if (next_op == ops.end())
+                             {
+                                 return false;
+                             }
+                             node_js = *next_op++;
+                             return true;
+                         },
+                         function_map,
+                         const_data_callback);
+}
+
+static shared_ptr<ngraph::Function>
+    read_function(const string& func_name,
+                  const vector<string>& func_parameters,
+                  const vector<string>& func_result,
+                  function<node_source_t> next_node,
+                  unordered_map<string, shared_ptr<Function>>& function_map,
+                  function<const_data_callback_t> const_data_callback)
 {
     shared_ptr<ngraph::Function> rc;
 
-    string func_name = func_js.at("name").get<string>();
-    vector<string> func_parameters = func_js.at("parameters").get<vector<string>>();
-    vector<string> func_result = func_js.at("result").get<vector<string>>();
     unordered_map<string, shared_ptr<Node>> node_map;
-    for (json node_js : func_js.at("ops"))
+    json node_js;
+    while (next_node(node_js))
     {
         try
         {
@@ -643,6 +1062,26 @@ static shared_ptr<ngraph::Function>
             {
                 node = make_shared<op::GreaterEq>(args[0], args[1]);
             }
+            else if (node_op == "GroupConvolution")
+            {
+                auto window_movement_strides =
+                    node_js.at("window_movement_strides").get<vector<size_t>>();
+                auto window_dilation_strides =
+                    node_js.at("window_dilation_strides").get<vector<size_t>>();
+                auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
+                auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
+                auto data_dilation_strides =
+                    node_js.at("data_dilation_strides").get<vector<size_t>>();
+                auto groups = node_js.at("groups").get<size_t>();
+                node = make_shared<op::GroupConvolution>(args[0],
+                                                         args[1],
+                                                         window_movement_strides,
+                                                         window_dilation_strides,
+                                                         padding_below,
+                                                         padding_above,
+                                                         data_dilation_strides,
+                                                         groups);
+            }
             else if (node_op == "Less")
             {
                 node = make_shared<op::Less>(args[0], args[1]);
@@ -1181,6 +1620,16 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "GreaterEq")
     {
     }
+    else if (node_op == "GroupConvolution")
+    {
+        auto tmp = dynamic_cast<const op::GroupConvolution*>(&n);
+        node["window_movement_strides"] = tmp->get_window_movement_strides();
+        node["window_dilation_strides"] = tmp->get_window_dilation_strides();
+        node["padding_below"] = tmp->get_padding_below();
+        node["padding_above"] = tmp->get_padding_above();
+        node["data_dilation_strides"] = tmp->get_data_dilation_strides();
+        node["groups"] = tmp->get_groups();
+    }
     else if (node_op == "Less")
     {
     }
@@ -48,11 +48,26 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to the versioned binary graph format, with constant data
+    ///    aligned in the stream. Nodes are written one at a time, so the whole document is never
+    ///    held in memory. deserialize() reads it back.
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a file in the binary graph format
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
     /// \brief Deserialize a Function
-    /// \param in An isteam to the input data
+    /// \param in An isteam to the input data, json, cpio or the binary graph format
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string to deseriailze, or the path to a cpio file. A cpio
+    ///    file is mapped and its constants use the mapped data in place, so the file must not be
+    ///    modified or rewritten while the Function or any of its constants are alive; doing so
+    ///    may raise SIGBUS on access. Removing the file is safe.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 }
@@ -0,0 +1,298 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief A vector of trivially copyable values which keeps the first N of them inside the
+    ///        object, so short lists (the users of an output, ...) need no allocation.
+    template <typename T, size_t N>
+    class SmallVector
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "SmallVector only holds trivially copyable values");
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        SmallVector() {}
+        SmallVector(const SmallVector& other) { assign(other.begin(), other.end()); }
+        SmallVector& operator=(const SmallVector& other)
+        {
+            if (this != &other)
+            {
+                m_size = 0;
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+        ~SmallVector()
+        {
+            if (m_data != m_inline)
+            {
+                delete[] m_data;
+            }
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        iterator begin() { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator begin() const { return m_data; }
+        const_iterator end() const { return m_data + m_size; }
+        T& operator[](size_t i) { return m_data[i]; }
+        const T& operator[](size_t i) const { return m_data[i]; }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return m_data[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return m_data[i];
+        }
+
+        void push_back(const T& value)
+        {
+            if (m_size == m_capacity)
+            {
+                reserve(2 * m_capacity);
+            }
+            m_data[m_size++] = value;
+        }
+
+        void reserve(size_t capacity)
+        {
+            if (capacity > m_capacity)
+            {
+                T* data = new T[capacity];
+                std::memcpy(data, m_data, m_size * sizeof(T));
+                if (m_data != m_inline)
+                {
+                    delete[] m_data;
+                }
+                m_data = data;
+                m_capacity = capacity;
+            }
+        }
+
+        iterator find(const T& value) { return std::find(begin(), end(), value); }
+        const_iterator find(const T& value) const { return std::find(begin(), end(), value); }
+        size_t count(const T& value) const { return std::count(begin(), end(), value); }
+        /// Removes the last occurrence of value; the order of the remaining values is kept.
+        /// The search starts at the back since recently added values tend to go first.
+        void erase(const T& value)
+        {
+            for (size_t i = m_size; i > 0; --i)
+            {
+                if (m_data[i - 1] == value)
+                {
+                    std::copy(m_data + i, end(), m_data + i - 1);
+                    m_size--;
+                    return;
+                }
+            }
+        }
+        void clear() { m_size = 0; }
+
+    private:
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("SmallVector index out of range");
+            }
+        }
+
+        void assign(const_iterator first, const_iterator last)
+        {
+            reserve(last - first);
+            std::copy(first, last, m_data);
+            m_size = last - first;
+        }
+
+        T* m_data = m_inline;
+        size_t m_size = 0;
+        size_t m_capacity = N;
+        T m_inline[N];
+    };
+
+    /// \brief A sequence of objects which never move once constructed.
+    ///
+    /// Descriptors point at each other, so node inputs and outputs used to live in a
+    /// std::deque, which allocates a map and a whole block even when empty. This keeps the
+    /// first N elements inside the object and allocates the rare extra ones one by one.
+    template <typename T, size_t N>
+    class StableVector
+    {
+    public:
+        template <typename V, typename Owner>
+        class Iterator : public std::iterator<std::random_access_iterator_tag, V>
+        {
+        public:
+            Iterator(Owner* owner, size_t index)
+                : m_owner(owner)
+                , m_index(index)
+            {
+            }
+            V& operator*() const { return (*m_owner)[m_index]; }
+            V* operator->() const { return &(*m_owner)[m_index]; }
+            V& operator[](ptrdiff_t n) const { return (*m_owner)[m_index + n]; }
+            Iterator& operator++()
+            {
+                m_index++;
+                return *this;
+            }
+            Iterator operator++(int) { return Iterator(m_owner, m_index++); }
+            Iterator& operator--()
+            {
+                m_index--;
+                return *this;
+            }
+            Iterator operator--(int) { return Iterator(m_owner, m_index--); }
+            Iterator& operator+=(ptrdiff_t n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(ptrdiff_t n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(ptrdiff_t n) const { return Iterator(m_owner, m_index + n); }
+            Iterator operator-(ptrdiff_t n) const { return Iterator(m_owner, m_index - n); }
+            ptrdiff_t operator-(const Iterator& other) const
+            {
+                return static_cast<ptrdiff_t>(m_index) - static_cast<ptrdiff_t>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+            bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+            bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+            bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+        private:
+            Owner* m_owner;
+            size_t m_index;
+        };
+
+        using value_type = T;
+        using iterator = Iterator<T, StableVector>;
+        using const_iterator = Iterator<const T, const StableVector>;
+
+        StableVector() {}
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector() { clear(); }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+        T& operator[](size_t i) { return *slot(i); }
+        const T& operator[](size_t i) const { return *const_cast<StableVector*>(this)->slot(i); }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return *slot(i);
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        T& front() { return at(0); }
+        const T& front() const { return at(0); }
+        T& back() { return at(m_size - 1); }
+        const T& back() const { return at(m_size - 1); }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size >= N)
+            {
+                m_overflow.push_back(static_cast<Storage*>(::operator new(sizeof(Storage))));
+            }
+            T* element = slot(m_size);
+            try
+            {
+                new (element) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (m_size >= N)
+                {
+                    ::operator delete(m_overflow.back());
+                    m_overflow.pop_back();
+                }
+                throw;
+            }
+            m_size++;
+            return *element;
+        }
+
+        void clear()
+        {
+            // Destroy in reverse order of construction
+            while (m_size > 0)
+            {
+                slot(--m_size)->~T();
+            }
+            for (Storage* storage : m_overflow)
+            {
+                ::operator delete(storage);
+            }
+            m_overflow.clear();
+        }
+
+    private:
+        using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        T* slot(size_t i)
+        {
+            return reinterpret_cast<T*>(i < N ? &m_inline[i] : m_overflow[i - N]);
+        }
+
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+
+        Storage m_inline[N];
+        std::vector<Storage*> m_overflow;
+        size_t m_size = 0;
+    };
+}
@@ -155,6 +155,7 @@ int main(int argc, char** argv)
     string model;
     string backend;
     string directory;
+    string pass_profile;
     int iterations = 10;
     bool failed = false;
     bool statistics = false;
@@ -206,6 +207,10 @@ int main(int argc, char** argv)
         {
             directory = argv[++i];
         }
+        else if (arg == "--pass_profile" || arg == "--pass-profile")
+        {
+            pass_profile = argv[++i];
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -264,10 +269,16 @@ OPTIONS
         --timing_detail           Gather detailed timing
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
+        --pass_profile <file>     Write per-pass compile time, node counts and rewrites as JSON
 )###";
         return 1;
     }
 
+    if (!pass_profile.empty())
+    {
+        pass::Manager::set_global_pass_profiling(true);
+    }
+
     if (visualize)
     {
         shared_ptr<Function> f = deserialize(model);
@@ -360,5 +371,11 @@ OPTIONS
         print_results(perf_shape, timing_detail);
     }
 
+    if (!pass_profile.empty())
+    {
+        ofstream out(pass_profile);
+        out << pass::pass_profile_to_json(pass::Manager::take_global_pass_profile()) << endl;
+    }
+
     return 0;
 }
@@ -0,0 +1,250 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// tool to compile a serialized ngraph function ahead of time into a shared library.
+// The library exports the function's entry point with the CPU backend's EntryPoint_t
+// signature and runs without the codegen JIT. A JSON manifest next to the library lists
+// the entry point, memory pool sizes and tensor layouts needed to call it.
+// The library is built for NGRAPH_TARGET_ARCH unless --march says otherwise, and needs
+// libngraph and libcpu_backend when it is loaded.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+void help()
+{
+    cout << R"###(
+DESCRIPTION
+    Compile a serialized model into a shared library for the CPU backend
+
+SYNOPSIS
+        ncompile [-i|--input <input file>] [-o|--output <output library>] [-s|--source_only]
+                 [--cxx <compiler>] [--cxxflags <flags>] [--march <architecture>]
+
+OPTIONS
+        -i or --input       input serialized model
+        -o or --output      output shared library, <name>.cpp and <name>.json are written
+                            next to it
+        -s or --source_only only generate the source and manifest
+        --cxx               C++ compiler used to build the library, defaults to $CXX or c++
+        --cxxflags          additional compiler flags, for example -L and -l options to link
+                            the library against the CPU backend
+        --march             target CPU architecture of the library, passed as -march to the
+                            compiler. Defaults to the architecture nGraph was built for
+                            ()###" NGRAPH_TARGET_ARCH R"###(), set it to the deployment host's
+                            architecture when that differs from the build host
+
+The library exports the function's entry point
+
+    extern "C" void <entry_point>(void** inputs, void** outputs, CPURuntimeContext* ctx);
+
+The caller owns the CPURuntimeContext. Allocate one AlignedBuffer per entry in
+memory_pool_sizes, set first_iteration before the first call and set p_en[i] for every
+input whose contents changed since the previous call. Functions using MKLDNN primitives or
+TBB flow graphs (NGRAPH_CPU_USE_TBB) are not supported.
+
+The library does not need the codegen JIT itself, but it calls into libngraph and
+libcpu_backend, which must be present when it is loaded. The libcpu_backend of a regular
+build links clang and LLVM; deploy one built with NGRAPH_DEX_ONLY from the same sources to
+leave them out.
+)###";
+}
+
+json layout_manifest(const shared_ptr<descriptor::TensorView>& tv,
+                     const shared_ptr<runtime::cpu::LayoutDescriptor>& layout)
+{
+    json manifest;
+    manifest["name"] = tv->get_name();
+    manifest["element_type"] = tv->get_element_type().c_type_string();
+    manifest["shape"] = tv->get_shape();
+    manifest["strides"] = layout->get_strides();
+    manifest["offset"] = layout->get_offset();
+    manifest["size"] = layout->get_allocated_size();
+    return manifest;
+}
+
+int main(int argc, char** argv)
+{
+    string input;
+    string output;
+    bool source_only = false;
+    string cxx = (getenv("CXX") == nullptr ? "c++" : getenv("CXX"));
+    string cxxflags;
+    string march = NGRAPH_TARGET_ARCH;
+    for (size_t i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "-o" || arg == "--output")
+        {
+            output = argv[++i];
+        }
+        else if (arg == "-i" || arg == "--input")
+        {
+            input = argv[++i];
+        }
+        else if (arg == "-s" || arg == "--source_only")
+        {
+            source_only = true;
+        }
+        else if (arg == "--cxx")
+        {
+            cxx = argv[++i];
+        }
+        else if (arg == "--cxxflags")
+        {
+            cxxflags = argv[++i];
+        }
+        else if (arg == "--march")
+        {
+            march = argv[++i];
+        }
+        else if (arg == "-h" || arg == "--help")
+        {
+            help();
+            return 0;
+        }
+    }
+
+    ifstream f(input);
+    if (!f)
+    {
+        cout << "failed to open '" << input << "' for input\n";
+        return 2;
+    }
+    if (output.empty())
+    {
+        cout << "no output library given\n";
+        return 1;
+    }
+    if (getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        cout << "TBB flow graphs are not supported, unset NGRAPH_CPU_USE_TBB\n";
+        return 1;
+    }
+
+    string stem = output;
+    if (stem.size() > 3 && stem.substr(stem.size() - 3) == ".so")
+    {
+        stem = stem.substr(0, stem.size() - 3);
+    }
+    string source_path = stem + ".cpp";
+    string manifest_path = stem + ".json";
+
+    try
+    {
+        shared_ptr<Function> function = deserialize(f);
+
+        stopwatch timer;
+        timer.start();
+        auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(function, false);
+        string code = external_function->generate_standalone_code();
+        timer.stop();
+        cout << "code generation took " << timer.get_milliseconds() << "ms\n";
+
+        if (!external_function->get_mkldnn_emitter()->get_mkldnn_primitives().empty())
+        {
+            cout << "'" << input << "' uses MKLDNN kernels, which are created at runtime and "
+                 << "cannot be compiled ahead of time\n";
+            return 1;
+        }
+
+        ofstream source(source_path);
+        source << code;
+        source.close();
+
+        json manifest;
+        manifest["entry_point"] = external_function->get_function_name();
+        manifest["memory_pool_sizes"] = external_function->get_memory_buffer_sizes();
+        manifest["memory_pool_alignment"] = size_t(
+            runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment);
+        manifest["op_count"] = external_function->get_op_attrs().size();
+        json inputs = json::array();
+        const auto& parameter_layouts = external_function->get_parameter_layout_descriptors();
+        size_t input_index = 0;
+        for (auto& parameter : function->get_parameters())
+        {
+            for (size_t i = 0; i < parameter->get_output_size(); i++)
+            {
+                inputs.push_back(layout_manifest(parameter->get_output_tensor_view(i),
+                                                 parameter_layouts.at(input_index++)));
+            }
+        }
+        manifest["inputs"] = inputs;
+        json outputs = json::array();
+        const auto& result_layouts = external_function->get_result_layout_descriptors();
+        for (size_t i = 0; i < function->get_output_size(); i++)
+        {
+            outputs.push_back(
+                layout_manifest(function->get_output_op(i)->get_output_tensor_view(),
+                                result_layouts.at(i)));
+        }
+        manifest["outputs"] = outputs;
+        ofstream manifest_file(manifest_path);
+        manifest_file << manifest.dump(4) << "\n";
+        manifest_file.close();
+    }
+    catch (const exception& e)
+    {
+        cout << "failed to generate code for '" << input << "': " << e.what() << "\n";
+        return 1;
+    }
+
+    if (!source_only)
+    {
+        stringstream command;
+        command << cxx << " -std=c++11 -O3 -march=" << march << " -fPIC -shared";
+#ifdef NGRAPH_HEADERS_PATH
+        command << " -I" << NGRAPH_HEADERS_PATH;
+#endif
+#ifdef EIGEN_HEADERS_PATH
+        command << " -I" << EIGEN_HEADERS_PATH;
+#endif
+#ifdef MKLDNN_HEADERS_PATH
+        command << " -I" << MKLDNN_HEADERS_PATH;
+#endif
+#ifdef TBB_HEADERS_PATH
+        command << " -I" << TBB_HEADERS_PATH;
+#endif
+        command << " " << source_path << " -o " << output << " " << cxxflags;
+
+        stopwatch timer;
+        timer.start();
+        int rc = system(command.str().c_str());
+        timer.stop();
+        if (rc != 0)
+        {
+            cout << "failed to build '" << output << "' with: " << command.str() << "\n";
+            return 1;
+        }
+        cout << "compilation took " << timer.get_milliseconds() << "ms\n";
+    }
+
+    return 0;
+}
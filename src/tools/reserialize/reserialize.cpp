@@ -36,11 +36,12 @@ DESCRIPTION
     Reserialize a serialized model
 
 SYNOPSIS
-        reserialize [-i|--input <input file>] [-o|--output <output file>]
+        reserialize [-i|--input <input file>] [-o|--output <output file>] [-f|--format <format>]
 
 OPTIONS
-        -i or --input  input serialized model
+        -i or --input  input serialized model, in any format
         -o or --output output serialized model
+        -f or --format output format, json (default) or binary
 )###";
 }
 
@@ -48,6 +49,7 @@ int main(int argc, char** argv)
 {
     string input;
     string output;
+    string format = "json";
     for (size_t i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -59,6 +61,10 @@ int main(int argc, char** argv)
         {
             input = argv[++i];
         }
+        else if (arg == "-f" || arg == "--format")
+        {
+            format = argv[++i];
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -66,7 +72,14 @@ int main(int argc, char** argv)
         }
     }
 
-    ifstream f(input);
+    if (format != "json" && format != "binary")
+    {
+        cout << "unknown output format '" << format << "'\n";
+        help();
+        return 1;
+    }
+
+    ifstream f(input, ios_base::binary | ios_base::in);
     if (f)
     {
         ngraph::stopwatch timer;
@@ -76,7 +89,14 @@ int main(int argc, char** argv)
         cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
 
         timer.start();
-        ngraph::serialize(output, function, 2);
+        if (format == "binary")
+        {
+            ngraph::serialize_binary(output, function);
+        }
+        else
+        {
+            ngraph::serialize(output, function, 2);
+        }
         timer.stop();
         cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
     }
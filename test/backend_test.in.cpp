@@ -15,11 +15,15 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <future>
 #include <random>
 #include <string>
+#include <thread>
 #include "gtest/gtest.h"
 
 #include "ngraph/autodiff/adjoints.hpp"
@@ -136,6 +140,155 @@ NGRAPH_TEST(${BACKEND_NAME}, aliased_output)
     EXPECT_EQ(expectedE, read_vector<float>(out7));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    atomic<size_t> completed{0};
+    auto callback = [&](bool rc, exception_ptr error) {
+        EXPECT_TRUE(rc);
+        EXPECT_FALSE(error);
+        completed++;
+    };
+
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>(4, static_cast<float>(i)));
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->call_async(f, {results.back()}, {a, b}, callback));
+    }
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        float x = static_cast<float>(i);
+        EXPECT_EQ((vector<float>{1 + x, 2 + x, 3 + x, 4 + x}), read_vector<float>(results[i]));
+    }
+    EXPECT_EQ(completed, futures.size());
+
+    // Errors are delivered through the future
+    auto error = backend->call_async(
+        f, {results[0]}, {results[1], results[2]}, [](bool rc, exception_ptr error) {
+            throw runtime_error("callback failed");
+        });
+    EXPECT_ANY_THROW(error.get());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async_destroy_backend)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Slow callbacks keep the calls in flight while the backend is destroyed
+    atomic<size_t> completed{0};
+    auto callback = [&](bool rc, exception_ptr error) {
+        this_thread::sleep_for(chrono::milliseconds(10));
+        completed++;
+    };
+
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>(4, static_cast<float>(i)));
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->call_async(f, {results.back()}, {a, b}, callback));
+    }
+    backend.reset();
+
+    // The destructor waits for every pending call
+    EXPECT_EQ(completed, futures.size());
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        float x = static_cast<float>(i);
+        EXPECT_EQ((vector<float>{1 + x, 2 + x, 3 + x, 4 + x}), read_vector<float>(results[i]));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, call_batch)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto f = make_shared<Function>(make_shared<op::Dot>(X, W), op::ParameterVector{X, W});
+    f->set_batch_axis(0, op::ParameterVector{X});
+    EXPECT_EQ(f->get_batch_size(), 4);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto w = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(w, vector<float>{1, 2, 3, 4, 5, 6});
+
+    // Requests of 1, 2 and 3 rows run as two batches, {1, 2} and {3}
+    vector<vector<float>> x_data{{1, 0, 0}, {0, 1, 0, 0, 0, 1}, {1, 1, 1, 2, 0, 0, 0, 0, 2}};
+    vector<vector<float>> expected{{1, 2}, {3, 4, 5, 6}, {9, 12, 2, 4, 10, 12}};
+    vector<runtime::TensorViewPtrs> inputs;
+    vector<runtime::TensorViewPtrs> outputs;
+    for (size_t i = 0; i < x_data.size(); i++)
+    {
+        auto x = backend->create_tensor(element::f32, Shape{i + 1, 3});
+        copy_data(x, x_data[i]);
+        inputs.push_back({x, w});
+        outputs.push_back({backend->create_tensor(element::f32, Shape{i + 1, 2})});
+    }
+
+    EXPECT_TRUE(backend->call_batch(f, outputs, inputs));
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i], read_vector<float>(outputs[i][0]));
+    }
+
+    // Shared inputs must be the same tensor in every request
+    inputs[1][1] = backend->create_tensor(element::f32, Shape{3, 2});
+    EXPECT_ANY_THROW(backend->call_batch(f, outputs, inputs));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, batch_coalescer)
+{
+    Shape shape{8, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A * B, op::ParameterVector{A, B});
+    f->set_batch_axis(0);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::BatchCoalescer coalescer(backend, f, chrono::milliseconds(1));
+
+    vector<runtime::TensorViewPtrs> outputs;
+    vector<future<bool>> results;
+    for (size_t i = 0; i < 20; i++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{1, 2});
+        auto b = backend->create_tensor(element::f32, Shape{1, 2});
+        copy_data(a, vector<float>{static_cast<float>(i), 1});
+        copy_data(b, vector<float>{2, static_cast<float>(i)});
+        outputs.push_back({backend->create_tensor(element::f32, Shape{1, 2})});
+        results.push_back(coalescer.submit(outputs.back(), {a, b}));
+    }
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_TRUE(results[i].get());
+        EXPECT_EQ((vector<float>{2.0f * i, static_cast<float>(i)}),
+                  read_vector<float>(outputs[i][0]));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, parameter_as_output)
 {
     Shape shape{3, 4};
@@ -6211,6 +6364,84 @@ NGRAPH_TEST(${BACKEND_NAME}, convolution_outlining)
     EXPECT_EQ(vector<float>{expected_result}, read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convolution_data_dilation_padding_above)
+{
+    Shape shape_a{1, 1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{1, 1, 2};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    // The dilated data {1, 0, 2, 0, 3} is padded to {0, 1, 0, 2, 0, 3, 0, 0}
+    auto conv_padded = make_shared<op::Convolution>(A,
+                                                    B,
+                                                    Strides{1},
+                                                    Strides{1},
+                                                    CoordinateDiff{1},
+                                                    CoordinateDiff{2},
+                                                    Strides{2});
+    // Taps two apart on {1, 0, 2, 0, 3, 0, 0}, the last window ends in the padding above
+    auto conv_strided = make_shared<op::Convolution>(A,
+                                                     B,
+                                                     Strides{2},
+                                                     Strides{2},
+                                                     CoordinateDiff{0},
+                                                     CoordinateDiff{2},
+                                                     Strides{2});
+    auto f =
+        make_shared<Function>(NodeVector{conv_padded, conv_strided}, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1, 10});
+    auto result_padded = backend->create_tensor(element::f32, Shape{1, 1, 7});
+    auto result_strided = backend->create_tensor(element::f32, Shape{1, 1, 3});
+
+    backend->call_with_validate(f, {result_padded, result_strided}, {a, b});
+    EXPECT_EQ((vector<float>{10, 1, 20, 2, 30, 3, 0}), read_vector<float>(result_padded));
+    EXPECT_EQ((vector<float>{21, 32, 3}), read_vector<float>(result_strided));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, group_convolution)
+{
+    Shape shape_a{2, 4, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{4, 2, 1, 1};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{2, 4, 2, 2};
+    auto group_conv = make_shared<op::GroupConvolution>(A,
+                                                        B,
+                                                        Strides{1, 1},
+                                                        Strides{1, 1},
+                                                        CoordinateDiff{0, 0},
+                                                        CoordinateDiff{0, 0},
+                                                        Strides{1, 1},
+                                                        2);
+    ASSERT_EQ(group_conv->get_shape(), shape_r);
+    auto f = make_shared<Function>(group_conv, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    vector<float> input(shape_size(shape_a));
+    iota(input.begin(), input.end(), 1.0f);
+    copy_data(a, input);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1.0f, 2.0f, 0.0f, -1.0f, 3.0f, 1.0f, -2.0f, 1.0f});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    // Filters 0-1 only see channels 0-1, filters 2-3 only see channels 2-3
+    vector<float> expected_result{11.0f,  14.0f,  17.0f,  20.0f,  -5.0f,  -6.0f,  -7.0f,  -8.0f,
+                                  40.0f,  44.0f,  48.0f,  52.0f,  -5.0f,  -6.0f,  -7.0f,  -8.0f,
+                                  59.0f,  62.0f,  65.0f,  68.0f,  -21.0f, -22.0f, -23.0f, -24.0f,
+                                  104.0f, 108.0f, 112.0f, 116.0f, -21.0f, -22.0f, -23.0f, -24.0f};
+
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ(expected_result, read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, computation_reuse)
 {
     Shape shape_a{1, 16, 2, 2};
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/constant_store.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(constant_store, deduplicate)
+{
+    auto& store = ConstantStore::get_default();
+    size_t buffers = store.get_buffer_count();
+    size_t bytes = store.get_byte_count();
+    {
+        vector<float> weights(1000, 0.5f);
+        auto a = make_shared<op::Constant>(element::f32, Shape{10, 100}, weights);
+        auto b = op::Constant::create(element::f32, Shape{1000}, weights);
+        auto c = make_shared<op::Constant>(element::f32, Shape{1000}, weights.data());
+        weights[0] = 1.0f;
+        auto d = make_shared<op::Constant>(element::f32, Shape{1000}, weights);
+
+        EXPECT_EQ(a->get_data_ptr(), b->get_data_ptr());
+        EXPECT_EQ(a->get_data_ptr(), c->get_data_ptr());
+        EXPECT_NE(a->get_data_ptr(), d->get_data_ptr());
+        EXPECT_EQ(a->get_buffer(), b->get_buffer());
+        EXPECT_EQ(buffers + 2, store.get_buffer_count());
+        EXPECT_EQ(bytes + 2 * 4000, store.get_byte_count());
+        EXPECT_EQ(0.5f, c->get_vector<float>()[0]);
+        EXPECT_EQ(1.0f, d->get_vector<float>()[0]);
+
+        // Copies of a graph share its constants
+        auto copy = a->copy_with_new_args({});
+        EXPECT_EQ(a->get_data_ptr(), static_pointer_cast<op::Constant>(copy)->get_data_ptr());
+    }
+    EXPECT_EQ(buffers, store.get_buffer_count());
+    EXPECT_EQ(bytes, store.get_byte_count());
+}
+
+TEST(constant_store, map_file)
+{
+    string path = file_util::tmp_filename(".bin");
+    vector<int32_t> values{1, 2, 3, 4, 5, 6};
+    {
+        ofstream out(path, ios::binary);
+        int32_t header = 42;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int32_t));
+    }
+
+    auto& store = ConstantStore::get_default();
+    auto buffer = store.map_file(path, sizeof(int32_t), values.size() * sizeof(int32_t));
+    file_util::remove_file(path);
+    auto c = make_shared<op::Constant>(element::i32, Shape{2, 3}, buffer);
+    EXPECT_EQ(values, c->get_vector<int32_t>());
+
+    EXPECT_TRUE(buffer->is_mapped());
+
+    // Mappings are not hashed, so constants with the same content do not find them
+    auto d = op::Constant::create(element::i32, Shape{6}, values);
+    EXPECT_NE(c->get_data_ptr(), d->get_data_ptr());
+
+    EXPECT_THROW(store.map_file(path, 0, 4), ngraph_error);
+    EXPECT_THROW(make_shared<op::Constant>(element::i32, Shape{7}, buffer), NodeValidationError);
+}
@@ -23,12 +23,16 @@
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/file_util.hpp"
+#ifdef NGRAPH_ONNX_IMPORT_ENABLE
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#endif
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
@@ -54,7 +58,6 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
-#include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -1736,8 +1739,7 @@ TEST(cpu_fusion, group_convolution)
                                                         CoordinateDiff{0, 0},
                                                         CoordinateDiff{0, 0},
                                                         Strides{1, 1},
-                                                        GROUPS,
-                                                        shape_r);
+                                                        GROUPS);
 
     Shape shape_c{1, 16, 2, 2};
     auto C = make_shared<op::Parameter>(element::f32, shape_c);
@@ -2199,6 +2201,71 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
     }
 }
 
+TEST(cpu_fusion, loop_kernel_fusion_activation_chain)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{3, 1111};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto half = op::Constant::create<float>(element::f32, Shape{}, std::vector<float>{0.5f});
+        auto scale = make_shared<op::Broadcast>(half, shape, AxisSet{0, 1});
+        auto t = make_shared<op::Tanh>(a * b + scale);
+        auto gate = make_shared<op::Sigmoid>(t) / make_shared<op::Sqrt>(b);
+        auto e = make_shared<op::Exp>(gate - make_shared<op::Log>(a));
+        auto m = make_shared<op::Maximum>(e, make_shared<op::Relu>(make_shared<op::Negative>(t)));
+        return make_shared<Function>(NodeVector{m, t}, op::ParameterVector{a, b});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(cpu_f), 0);
+
+    test::Uniform<float> rng(0.1f, 3.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_unsupported_types)
+{
+    // The kernel is only built for f32, f64, i32 and i64
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto a = make_shared<op::Parameter>(element::i8, Shape{4});
+        auto f = make_shared<Function>(make_shared<op::Abs>(make_shared<op::Negative>(a)),
+                                       op::ParameterVector{a});
+        return f;
+    };
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 0);
+
+    vector<vector<int8_t>> args{{-3, 0, 5, -7}};
+    EXPECT_EQ((vector<int8_t>{3, 0, 5, 7}), execute(make_function(), args, "CPU").at(0));
+
+    // and evaluates transcendental ops on real types only
+    auto b = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto g = make_shared<Function>(make_shared<op::Sqrt>(make_shared<op::Abs>(b)),
+                                   op::ParameterVector{b});
+    pass_manager.run_passes(g);
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(g), 0);
+}
+
 TEST(cpu_fusion, sigmoid_multiply_fusion)
 {
     pass::Manager pass_manager;
@@ -2707,6 +2774,35 @@ TEST(cpu_fusion, fuse_rnn_across_2layer_1timestep)
     }
 }
 
+#ifdef NGRAPH_ONNX_IMPORT_ENABLE
+TEST(cpu_fusion, fuse_onnx_lstm)
+{
+    // The ONNX importer marks its LSTM cells as fusable, so they are fused without
+    // NGRAPH_CPU_RNN_FUSION
+    const string model = file_util::path_join(SERIALIZED_ZOO, "onnx/lstm_fwd_default.onnx");
+    auto cpu_f = onnx_import::import_onnx_function(model);
+    auto int_f = onnx_import::import_onnx_function(model);
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    EXPECT_EQ(0, count_ops_of_type<op::Lstm>(cpu_f));
+    EXPECT_EQ(1, count_ops_of_type<op::Rnn>(cpu_f));
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+#endif
+
 static void check_bounded_relu(Shape param_shape, float constant_val)
 {
     auto make_function = [](Shape input_shape, float alpha_val) {
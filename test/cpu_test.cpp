@@ -15,10 +15,23 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdio>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <tbb/parallel_for.h>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -28,9 +41,15 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -191,3 +210,683 @@ TEST(cpu_test, mkldnn_layouts)
 
     EXPECT_EQ(vector<float>{expected_result}, rv);
 }
+
+TEST(cpu_test, concurrent_calls)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+
+    const size_t thread_count = 4;
+    vector<vector<float>> results(thread_count);
+    vector<thread> threads;
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        threads.emplace_back([&, i]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto c = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            float scale = static_cast<float>(i + 1);
+            copy_data(a, vector<float>{1 * scale, 2 * scale, 3 * scale, 4 * scale});
+            copy_data(b, vector<float>{5, 6, 7, 8});
+            copy_data(c, vector<float>{1, 1, 2, 2});
+            for (size_t j = 0; j < 100; j++)
+            {
+                backend->call(f, {result}, {a, b, c});
+            }
+            results[i] = read_vector<float>(result);
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        float scale = static_cast<float>(i + 1);
+        vector<float> expected{
+            1 * scale + 5, 2 * scale + 6, 2 * (3 * scale + 7), 2 * (4 * scale + 8)};
+        EXPECT_EQ(expected, results[i]);
+    }
+}
+
+TEST(cpu_test, codegen_object_cache)
+{
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_codegen_cache_test");
+    file_util::remove_directory(cache_dir);
+    setenv("NGRAPH_CPU_CODEGEN_CACHE_DIR", cache_dir.c_str(), 1);
+
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto K = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+        return make_shared<Function>((A + B) * K, op::ParameterVector{A, B});
+    };
+
+    // The second external function compiles an identical graph whose nodes have fresh
+    // names and loads the cached object code
+    bool codegen = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        // Advance the node and function counters between the two graphs
+        make_function();
+
+        auto f = make_function();
+        auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f, false);
+        if (external_function->is_direct_execution())
+        {
+            codegen = false;
+            break;
+        }
+        auto call_frame = external_function->make_call_frame();
+        EXPECT_EQ(external_function->is_object_cached(), i == 1);
+
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+
+        call_frame->call({result}, {a, b});
+        EXPECT_EQ((vector<float>{6, 16, 30, 48}), read_vector<float>(result));
+    }
+
+    size_t objects = 0;
+    file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) {
+        if (!is_dir && file.size() > 2 && file.compare(file.size() - 2, 2, ".o") == 0)
+        {
+            objects++;
+        }
+    });
+    if (codegen)
+    {
+        EXPECT_EQ(objects, 1);
+    }
+
+    unsetenv("NGRAPH_CPU_CODEGEN_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
+
+TEST(cpu_test, standalone_code)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto K = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>((A + B) * K, op::ParameterVector{A, B});
+
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f, false);
+    if (external_function->is_direct_execution())
+    {
+        return;
+    }
+    string code = external_function->generate_standalone_code();
+    ASSERT_TRUE(external_function->get_mkldnn_emitter()->get_mkldnn_primitives().empty());
+
+    // Constant data is embedded in the source, so the library does not bind constants
+    EXPECT_EQ(code.find(external_function->get_function_name() + "_bind_constants"),
+              string::npos);
+
+    codegen::Compiler compiler;
+    auto module = compiler.compile(code);
+    ASSERT_NE(module, nullptr);
+    codegen::ExecutionEngine engine;
+    engine.add_module(module);
+    engine.finalize();
+    auto entry_point =
+        engine.find_function<runtime::cpu::EntryPoint_t>(external_function->get_function_name());
+    ASSERT_NE(entry_point, nullptr);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    auto call_frame = make_shared<runtime::cpu::CPU_CallFrame>(external_function, entry_point);
+    call_frame->call({result}, {a, b});
+    EXPECT_EQ((vector<float>{6, 16, 30, 48}), read_vector<float>(result));
+}
+
+TEST(cpu_test, thread_pool)
+{
+    runtime::cpu::CPUThreadPool::Config config;
+    config.intra_op_threads = 1;
+    config.inter_op_threads = 2;
+    auto thread_pool = make_shared<runtime::cpu::CPUThreadPool>(config);
+    EXPECT_EQ(thread_pool->get_config().intra_op_threads, 1);
+    EXPECT_EQ(thread_pool->get_config().inter_op_threads, 2);
+    EXPECT_FALSE(thread_pool->get_cores().empty());
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B) + A, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    ASSERT_NE(cpu_backend, nullptr);
+    EXPECT_EQ(cpu_backend->get_thread_pool(), runtime::cpu::CPUThreadPool::get_default());
+    cpu_backend->set_thread_pool(thread_pool);
+    EXPECT_EQ(cpu_backend->get_thread_pool(), thread_pool);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{20, 24, 46, 54}), read_vector<float>(result));
+
+    // Calls restore the calling thread's pool
+    EXPECT_EQ(&runtime::cpu::CPUThreadPool::get_current(),
+              runtime::cpu::CPUThreadPool::get_default().get());
+}
+
+TEST(cpu_test, thread_pool_inter_op)
+{
+    bool dex = (getenv("NGRAPH_DEX") != nullptr);
+    if (!dex)
+    {
+        setenv("NGRAPH_DEX", "1", 1);
+    }
+
+    runtime::cpu::CPUThreadPool::Config config;
+    config.intra_op_threads = 1;
+    config.inter_op_threads = 4;
+    auto thread_pool = make_shared<runtime::cpu::CPUThreadPool>(config);
+    ASSERT_NE(thread_pool->get_inter_op_pool(), nullptr);
+
+    // Independent branches joined by a chain of adds
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> sum;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto c = op::Constant::create(element::f32, shape, vector<float>(4, i));
+        auto branch = make_shared<op::Relu>(make_shared<op::Negative>(A * c));
+        sum = (sum == nullptr ? branch : sum + branch);
+    }
+    auto f = make_shared<Function>(NodeVector{sum, make_shared<op::Negative>(A)},
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend)->set_thread_pool(thread_pool);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto negated = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-1, -2, 3, 0});
+    backend->call_with_validate(f, {result, negated}, {a});
+    EXPECT_EQ((vector<float>{28, 56, 0, 0}), read_vector<float>(result));
+    EXPECT_EQ((vector<float>{1, 2, -3, 0}), read_vector<float>(negated));
+
+    copy_data(a, vector<float>{-2, 1, 0, -1});
+    backend->call_with_validate(f, {result, negated}, {a});
+    EXPECT_EQ((vector<float>{56, 0, 0, 28}), read_vector<float>(result));
+    EXPECT_EQ((vector<float>{2, -1, 0, 1}), read_vector<float>(negated));
+
+    if (!dex)
+    {
+        unsetenv("NGRAPH_DEX");
+    }
+}
+
+TEST(cpu_test, thread_pool_environment)
+{
+    if (getenv("OMP_NUM_THREADS") != nullptr)
+    {
+        return;
+    }
+    setenv("NGRAPH_INTRA_OP_PARALLELISM", "3", 1);
+    setenv("NGRAPH_INTER_OP_PARALLELISM", "2", 1);
+    auto config = runtime::cpu::CPUThreadPool::Config::from_environment();
+    EXPECT_EQ(config.intra_op_threads, 3);
+    EXPECT_EQ(config.inter_op_threads, 2);
+    unsetenv("NGRAPH_INTRA_OP_PARALLELISM");
+    unsetenv("NGRAPH_INTER_OP_PARALLELISM");
+}
+
+#if defined(__linux__)
+TEST(cpu_test, thread_pool_restores_affinity)
+{
+    cpu_set_t process_mask;
+    CPU_ZERO(&process_mask);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(process_mask), &process_mask), 0);
+
+    runtime::cpu::CPUThreadPool::Config config;
+    config.inter_op_threads = 2;
+    config.pin_threads = true;
+    auto thread_pool = make_shared<runtime::cpu::CPUThreadPool>(config);
+    config.cores = {thread_pool->get_cores().front()};
+    thread_pool = make_shared<runtime::cpu::CPUThreadPool>(config);
+
+    cpu_set_t pool_mask;
+    CPU_ZERO(&pool_mask);
+    CPU_SET(config.cores.front(), &pool_mask);
+
+    auto current_mask = []() {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        pthread_getaffinity_np(pthread_self(), sizeof(mask), &mask);
+        return mask;
+    };
+
+    // Workers are bound to the pool's cores while they run in its arena
+    pthread_t caller = pthread_self();
+    mutex workers_mutex;
+    set<pthread_t> workers;
+    thread_pool->get_task_arena().execute([&]() {
+        tbb::parallel_for(0, 64, [&](int) {
+            if (!pthread_equal(pthread_self(), caller))
+            {
+                cpu_set_t mask = current_mask();
+                lock_guard<mutex> lock(workers_mutex);
+                EXPECT_TRUE(CPU_EQUAL(&mask, &pool_mask));
+                workers.insert(pthread_self());
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        });
+    });
+
+    // and get the process affinity back once they leave it
+    tbb::task_arena other_arena(4);
+    other_arena.execute([&]() {
+        tbb::parallel_for(0, 256, [&](int) {
+            cpu_set_t mask = current_mask();
+            lock_guard<mutex> lock(workers_mutex);
+            if (workers.count(pthread_self()) != 0)
+            {
+                EXPECT_TRUE(CPU_EQUAL(&mask, &process_mask));
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        });
+    });
+    cpu_set_t caller_mask = current_mask();
+    EXPECT_TRUE(CPU_EQUAL(&caller_mask, &process_mask));
+}
+#endif
+
+TEST(cpu_test, dynamic_batch)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Dot>(A, B)},
+                                   op::ParameterVector{A, B});
+    f->set_batch_axis(0, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto b = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(b, vector<float>{1, 0, 0, 1, 1, 1});
+
+    // Runs the specialization for a batch of 4 with one padded row
+    auto a = backend->create_tensor(element::f32, Shape{3, 3});
+    auto result = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{4, 5, 10, 11, 16, 17}), read_vector<float>(result));
+
+    a = backend->create_tensor(element::f32, Shape{1, 3});
+    result = backend->create_tensor(element::f32, Shape{1, 2});
+    copy_data(a, vector<float>{1, 1, 1});
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{2, 2}), read_vector<float>(result));
+
+    a = backend->create_tensor(element::f32, Shape{2, 3});
+    result = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(a, vector<float>{0, 0, 1, 1, 0, 0});
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{1, 1, 1, 0}), read_vector<float>(result));
+}
+
+TEST(cpu_test, dynamic_batch_dependent_slices)
+{
+    // Reverse and Softmax over the batch axis would see the padding rows of a batch of 4
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::Reverse>(A, AxisSet{0}),
+                   make_shared<op::Softmax>(A, AxisSet{0})},
+        op::ParameterVector{A});
+    f->set_batch_axis(0);
+    EXPECT_FALSE(has_independent_batch_slices(*f));
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, Shape{3, 2});
+    auto reversed = backend->create_tensor(element::f32, Shape{3, 2});
+    auto softmax = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    backend->call(f, {reversed, softmax}, {a});
+    EXPECT_EQ((vector<float>{5, 6, 3, 4, 1, 2}), read_vector<float>(reversed));
+
+    float d0 = 1 + expf(2) + expf(4);
+    EXPECT_TRUE(test::all_close(
+        (vector<float>{1 / d0, 1 / d0, expf(2) / d0, expf(2) / d0, expf(4) / d0, expf(4) / d0}),
+        read_vector<float>(softmax)));
+}
+
+TEST(cpu_test, index_reduction_and_topk_large)
+{
+    Shape shape{8, 1000, 4};
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<float> input(shape_size(shape));
+    rng.initialize(input);
+    vector<vector<float>> args{input};
+
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        auto make_argmax = [&]() {
+            auto A = make_shared<op::Parameter>(element::f32, shape);
+            return make_shared<Function>(make_shared<op::ArgMax>(A, axis, element::i64),
+                                         op::ParameterVector{A});
+        };
+        auto make_argmin = [&]() {
+            auto A = make_shared<op::Parameter>(element::f32, shape);
+            return make_shared<Function>(make_shared<op::ArgMin>(A, axis, element::i64),
+                                         op::ParameterVector{A});
+        };
+        EXPECT_EQ((execute<float, int64_t>(make_argmax(), args, "INTERPRETER")),
+                  (execute<float, int64_t>(make_argmax(), args, "CPU")));
+        EXPECT_EQ((execute<float, int64_t>(make_argmin(), args, "INTERPRETER")),
+                  (execute<float, int64_t>(make_argmin(), args, "CPU")));
+
+        for (size_t k : {size_t(1), size_t(3), shape[axis]})
+        {
+            for (bool compute_max : {true, false})
+            {
+                auto make_topk = [&](size_t output) {
+                    auto A = make_shared<op::Parameter>(element::f32, shape);
+                    auto B = make_shared<op::TopK>(A, axis, element::i32, k, compute_max);
+                    return make_shared<Function>(make_shared<op::GetOutputElement>(B, output),
+                                                 op::ParameterVector{A});
+                };
+                EXPECT_EQ((execute<float, int32_t>(make_topk(0), args, "INTERPRETER")),
+                          (execute<float, int32_t>(make_topk(0), args, "CPU")));
+                EXPECT_EQ((execute<float>(make_topk(1), args, "INTERPRETER")),
+                          (execute<float>(make_topk(1), args, "CPU")));
+            }
+        }
+    }
+}
+
+TEST(cpu_test, index_reduction_and_topk_nan)
+{
+    float nan = numeric_limits<float>::quiet_NaN();
+    vector<float> row{-1, nan, 2, -1, 1, 0, 1, 3, nan, -3, 2};
+
+    // Along the innermost axis, and along the outer axis of two equal columns
+    vector<float> columns;
+    for (float value : row)
+    {
+        columns.push_back(value);
+        columns.push_back(value);
+    }
+    auto make_index_reduction = [](const Shape& shape, size_t axis, bool compute_max) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        shared_ptr<Node> reduction;
+        if (compute_max)
+        {
+            reduction = make_shared<op::ArgMax>(A, axis, element::i32);
+        }
+        else
+        {
+            reduction = make_shared<op::ArgMin>(A, axis, element::i32);
+        }
+        return make_shared<Function>(reduction, op::ParameterVector{A});
+    };
+    for (string backend : {"INTERPRETER", "CPU"})
+    {
+        EXPECT_EQ((vector<int32_t>{7}),
+                  (execute<float, int32_t>(
+                      make_index_reduction(Shape{1, 11}, 1, true), {row}, backend)[0]));
+        EXPECT_EQ((vector<int32_t>{9}),
+                  (execute<float, int32_t>(
+                      make_index_reduction(Shape{1, 11}, 1, false), {row}, backend)[0]));
+        EXPECT_EQ((vector<int32_t>{7, 7}),
+                  (execute<float, int32_t>(
+                      make_index_reduction(Shape{11, 2}, 0, true), {columns}, backend)[0]));
+        EXPECT_EQ((vector<int32_t>{9, 9}),
+                  (execute<float, int32_t>(
+                      make_index_reduction(Shape{11, 2}, 0, false), {columns}, backend)[0]));
+    }
+
+    // NaN values are never among the k best, with the heap (k = 1) or a partition of the row
+    vector<float> rows(row);
+    rows.insert(rows.end(), row.begin(), row.end());
+    auto make_topk = [](size_t k, bool compute_max, size_t output) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{22});
+        auto B = make_shared<op::TopK>(A, 0, element::i32, k, compute_max);
+        return make_shared<Function>(make_shared<op::GetOutputElement>(B, output),
+                                     op::ParameterVector{A});
+    };
+    EXPECT_EQ((vector<int32_t>{18}),
+              (execute<float, int32_t>(make_topk(1, true, 0), {rows}, "CPU")[0]));
+    EXPECT_EQ((vector<int32_t>{9}),
+              (execute<float, int32_t>(make_topk(1, false, 0), {rows}, "CPU")[0]));
+    EXPECT_EQ((vector<int32_t>{18, 7, 21}),
+              (execute<float, int32_t>(make_topk(3, true, 0), {rows}, "CPU")[0]));
+    EXPECT_EQ((vector<float>{3, 3, 2}), (execute<float>(make_topk(3, true, 1), {rows}, "CPU")[0]));
+    EXPECT_EQ((vector<int32_t>{9, 20, 0}),
+              (execute<float, int32_t>(make_topk(3, false, 0), {rows}, "CPU")[0]));
+    EXPECT_EQ((vector<float>{-3, -3, -1}),
+              (execute<float>(make_topk(3, false, 1), {rows}, "CPU")[0]));
+}
+
+TEST(cpu_test, mkldnn_primitive_cache)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{2, 2, 3, 3});
+        auto conv = make_shared<op::Convolution>(A, B, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(make_shared<op::Relu>(conv), op::ParameterVector{A, B});
+    };
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(shape_size(Shape{1, 2, 5, 5}));
+    vector<float> b(shape_size(Shape{2, 2, 3, 3}));
+    rng.initialize(a);
+    rng.initialize(b);
+    vector<vector<float>> args{a, b};
+
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get_default();
+    auto hit_count = cache.get_hit_count();
+
+    // Primitives are returned to the cache when the first backend is destroyed and picked up
+    // by the second compilation
+    auto expected = execute(make_function(), args, "CPU");
+    EXPECT_GT(cache.size(), 0);
+    auto result = execute(make_function(), args, "CPU");
+    EXPECT_GT(cache.get_hit_count(), hit_count);
+    EXPECT_TRUE(test::all_close(expected[0], result[0]));
+    EXPECT_TRUE(test::all_close(execute(make_function(), args, "INTERPRETER")[0], result[0]));
+
+    auto capacity = cache.get_capacity();
+    cache.set_capacity(0);
+    EXPECT_EQ(0, cache.size());
+    cache.set_capacity(capacity);
+}
+
+TEST(cpu_test, layout_conversions_shared)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto conv = make_shared<op::Convolution>(A, B, Strides{1, 1}, Strides{1, 1});
+        // Neither consumer has an MKLDNN kernel, both read the convolution in native layout
+        auto abs = make_shared<op::Abs>(conv);
+        auto negative = make_shared<op::Negative>(conv);
+        return make_shared<Function>(NodeVector{abs, negative}, op::ParameterVector{A, B});
+    };
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(shape_size(Shape{1, 16, 8, 8}));
+    vector<float> b(shape_size(Shape{16, 16, 3, 3}));
+    rng.initialize(a);
+    rng.initialize(b);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto f = make_function();
+    auto a_tensor = backend->create_tensor(element::f32, Shape{1, 16, 8, 8});
+    auto b_tensor = backend->create_tensor(element::f32, Shape{16, 16, 3, 3});
+    copy_data(a_tensor, a);
+    copy_data(b_tensor, b);
+    auto abs_result = backend->create_tensor(element::f32, Shape{1, 16, 6, 6});
+    auto negative_result = backend->create_tensor(element::f32, Shape{1, 16, 6, 6});
+    backend->call_with_validate(f, {abs_result, negative_result}, {a_tensor, b_tensor});
+
+    auto expected = execute(make_function(), vector<vector<float>>{a, b}, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(expected[0], read_vector<float>(abs_result)));
+    EXPECT_TRUE(test::all_close(expected[1], read_vector<float>(negative_result)));
+
+    // A tensor is converted at most once to each layout, whatever the number of consumers:
+    // the data and weights are blocked for the convolution and its blocked output is
+    // converted back to native layout once for both consumers
+    auto conversions = cpu_backend->get_layout_conversions(f);
+    EXPECT_EQ(conversions.size(), 3);
+    size_t to_native = 0;
+    for (size_t i = 0; i < conversions.size(); i++)
+    {
+        EXPECT_GT(conversions[i].Bytes, 0);
+        EXPECT_FALSE(conversions[i].Consumers.empty());
+        for (size_t j = i + 1; j < conversions.size(); j++)
+        {
+            EXPECT_FALSE(conversions[i].Input == conversions[j].Input &&
+                         conversions[i].OutputFormat == conversions[j].OutputFormat);
+        }
+        if (conversions[i].OutputFormat == "memory::format::nchw")
+        {
+            to_native++;
+            EXPECT_EQ(conversions[i].Consumers.size(), 2);
+            EXPECT_EQ(conversions[i].Bytes, shape_size(Shape{1, 16, 6, 6}) * sizeof(float));
+        }
+    }
+    EXPECT_EQ(to_native, 1);
+}
+
+TEST(cpu_test, layout_elementwise_cost)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto W1 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto P = make_shared<op::Parameter>(element::f32, Shape{1, 16, 6, 6});
+        auto W2 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto conv1 = make_shared<op::Convolution>(A, W1, Strides{1, 1}, Strides{1, 1});
+        // The native first input loses to the blocked convolution output, which needs no
+        // reorder for the convolution consuming the sum
+        auto add = make_shared<op::Add>(P, conv1);
+        auto conv2 = make_shared<op::Convolution>(add, W2, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(conv2, op::ParameterVector{A, W1, P, W2});
+    };
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : make_function()->get_parameters())
+    {
+        vector<float> arg(shape_size(param->get_shape()));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+
+    auto f = make_function();
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    vector<shared_ptr<runtime::TensorView>> arg_tensors;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        arg_tensors.push_back(
+            backend->create_tensor(element::f32, f->get_parameters().at(i)->get_shape()));
+        copy_data(arg_tensors.back(), args[i]);
+    }
+    auto result = backend->create_tensor(element::f32, Shape{1, 16, 4, 4});
+    backend->call_with_validate(f, {result}, arg_tensors);
+
+    auto expected = execute(make_function(), args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(expected.at(0), read_vector<float>(result), 1.0e-4f, 1.0e-4f));
+
+    size_t to_native = 0;
+    size_t add_inputs = 0;
+    for (auto& conversion : cpu_backend->get_layout_conversions(f))
+    {
+        if (conversion.OutputFormat == "memory::format::nchw")
+        {
+            // Only the result of the second convolution
+            to_native++;
+        }
+        for (auto& consumer : conversion.Consumers)
+        {
+            if (consumer.compare(0, 4, "Add_") == 0)
+            {
+                add_inputs++;
+                EXPECT_EQ(conversion.InputFormat, "memory::format::nchw");
+            }
+        }
+    }
+    EXPECT_EQ(to_native, 1);
+    EXPECT_EQ(add_inputs, 1);
+}
+
+TEST(cpu_test, group_convolution_reference)
+{
+    // MKLDNN takes neither rank-3 nor data dilated group convolutions, so this runs the
+    // reference kernel, once through codegen and once through DEX
+    bool dex = (getenv("NGRAPH_DEX") != nullptr);
+    for (bool use_dex : {false, true})
+    {
+        if (use_dex)
+        {
+            setenv("NGRAPH_DEX", "1", 1);
+        }
+        else
+        {
+            unsetenv("NGRAPH_DEX");
+        }
+
+        Shape shape_a{1, 4, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        Shape shape_b{4, 2, 2};
+        auto B = make_shared<op::Parameter>(element::f32, shape_b);
+        auto group_conv = make_shared<op::GroupConvolution>(A,
+                                                            B,
+                                                            Strides{1},
+                                                            Strides{1},
+                                                            CoordinateDiff{0},
+                                                            CoordinateDiff{0},
+                                                            Strides{2},
+                                                            2);
+        Shape shape_r{1, 4, 4};
+        ASSERT_EQ(group_conv->get_shape(), shape_r);
+        auto f = make_shared<Function>(group_conv, op::ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, shape_a);
+        vector<float> input(shape_size(shape_a));
+        iota(input.begin(), input.end(), 1.0f);
+        copy_data(a, input);
+        auto b = backend->create_tensor(element::f32, shape_b);
+        copy_data(b, vector<float>{1, 0, 0, 1, 2, 1, 0, -1, 1, -1, 1, 1, 0, 2, -1, 0});
+        auto result = backend->create_tensor(element::f32, shape_r);
+
+        backend->call_with_validate(f, {result}, {a, b});
+        EXPECT_FALSE(runtime::cpu::mkldnn_utils::use_mkldnn_kernel(group_conv.get()));
+        EXPECT_EQ((vector<float>{1, 5, 2, 6, 2, -3, 4, -3, 17, 3, 19, 3, -10, 16, -11, 18}),
+                  read_vector<float>(result));
+    }
+
+    if (dex)
+    {
+        setenv("NGRAPH_DEX", "1", 1);
+    }
+    else
+    {
+        unsetenv("NGRAPH_DEX");
+    }
+}
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 #include "gtest/gtest.h"
@@ -195,6 +196,27 @@ TEST(onnx, model_conv2d_strides_assymetric_padding)
     EXPECT_EQ(expected_output, result.front());
 }
 
+TEST(onnx, model_conv2d_group)
+{
+    // Grouped convolution is imported as a single op::GroupConvolution
+    auto function = onnx_import::import_onnx_function(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/conv2d_group.onnx"));
+    EXPECT_EQ(count_ops_of_type<op::GroupConvolution>(function), 1);
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(function), 0);
+
+    // data (1, 4, 3, 3) with values 0..35, filters (4, 2, 2, 2), bias (4), group = 2
+    std::vector<float> data(36);
+    std::iota(data.begin(), data.end(), 0.f);
+    Inputs inputs{data};
+
+    // output (1, 4, 2, 2)
+    Outputs expected_outputs{{-10.f, -13.f, -19.f, -22.f, 2.f, 3.f, 5.f, 6.f,
+                              -1.f, -1.f, -1.f, -1.f, -27.f, -28.f, -30.f, -31.f}};
+
+    Outputs outputs{execute(function, inputs, "INTERPRETER")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
 TEST(onnx, model_average_pool_2d)
 {
     // Pooling with strides=2 and no padding
@@ -764,3 +786,111 @@ TEST(onnx, model_shape)
         execute<float, int64_t>(function, inputs, "INTERPRETER");
     EXPECT_TRUE(test::all_close(expected_output.front(), outputs.front()));
 }
+
+TEST(onnx, model_lstm_bidirectional_peepholes)
+{
+    Model model{onnx_import::load_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/lstm_bidir_peepholes.onnx"))};
+
+    // X (3, 2, 2), initial_h (2, 2, 3), initial_c (2, 2, 3)
+    Inputs inputs{{0.991665f, 0.675463f, 0.041581f, -0.611858f, -0.977530f, -0.883455f,
+                   -0.373877f, 0.311541f, 0.850436f, 0.989358f, 0.662969f, 0.024776f},
+                  {-0.220274f, 0.046620f, 0.291588f, 0.399417f, 0.319395f, 0.089156f,
+                   -0.183014f, -0.369110f, -0.381608f, -0.214629f, 0.053293f, 0.296150f},
+                  {0.242910f, 0.539225f, 0.581934f, 0.350950f, -0.045091f, -0.419925f,
+                   -0.597262f, -0.493697f, -0.157940f, 0.252100f, 0.543573f, 0.579395f}};
+
+    // Y (3, 2, 2, 3), Y_h (2, 2, 3), Y_c (2, 2, 3)
+    Outputs expected_outputs{
+        {0.000382f,  0.064482f,  0.099900f,  0.001131f,  0.087225f,  0.083398f,
+         0.073969f,  0.022963f,  -0.149285f, -0.098364f, -0.045843f, -0.017311f,
+         -0.044354f, 0.200356f,  0.249851f,  -0.076110f, 0.071453f,  0.130733f,
+         -0.093581f, -0.121985f, -0.000097f, -0.022063f, 0.043233f,  -0.034187f,
+         -0.108868f, 0.067623f,  0.102060f,  -0.054829f, -0.007431f, 0.066843f,
+         0.048224f,  -0.062832f, -0.182593f, 0.046406f,  0.201079f,  0.053109f},
+        {-0.108868f, 0.067623f, 0.102060f, -0.054829f, -0.007431f, 0.066843f,
+         0.073969f, 0.022963f, -0.149285f, -0.098364f, -0.045843f, -0.017311f},
+        {-0.157542f, 0.094623f, 0.271107f, -0.090710f, -0.011477f, 0.140477f,
+         0.240210f, 0.040844f, -0.208815f, -0.192875f, -0.097354f, -0.034702f}};
+
+    ASSERT_EQ(model.size(), expected_outputs.size());
+    for (std::size_t i = 0; i < expected_outputs.size(); ++i)
+    {
+        Outputs outputs{execute(model[i], inputs, "INTERPRETER")};
+        EXPECT_TRUE(test::all_close(expected_outputs[i], outputs.front(), 1.0e-4f, 1.0e-6f));
+    }
+}
+
+TEST(onnx, model_lstm_forward_default)
+{
+    // Only Y_h is requested, the remaining outputs are omitted
+    auto function = onnx_import::import_onnx_function(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/lstm_fwd_default.onnx"));
+
+    // X (4, 1, 3)
+    Inputs inputs{{-0.761984f, -0.165605f, 0.508662f, 0.943696f, 0.934895f, 0.486399f,
+                   -0.190858f, -0.778352f, -0.999774f, -0.750987f, -0.148998f, 0.523065f}};
+
+    // Y_h (1, 1, 2)
+    Outputs expected_outputs{{0.041180f, -0.054261f}};
+
+    Outputs outputs{execute(function, inputs, "INTERPRETER")};
+    EXPECT_TRUE(test::all_close(expected_outputs.front(), outputs.front(), 1.0e-4f, 1.0e-6f));
+}
+
+namespace
+{
+    void gru_forward_check(const std::string& model_path, const Outputs& expected_outputs)
+    {
+        Model model{onnx_import::load_onnx_model(file_util::path_join(SERIALIZED_ZOO, model_path))};
+
+        // X (3, 2, 2)
+        Inputs inputs{{0.287052f, -0.397555f, -0.895188f, -0.971799f, -0.591358f, 0.067209f,
+                       0.694164f, 0.994645f, 0.827328f, 0.270906f, -0.412928f, -0.902554f}};
+
+        ASSERT_EQ(model.size(), expected_outputs.size());
+        for (std::size_t i = 0; i < expected_outputs.size(); ++i)
+        {
+            Outputs outputs{execute(model[i], inputs, "INTERPRETER")};
+            EXPECT_TRUE(test::all_close(expected_outputs[i], outputs.front(), 1.0e-4f, 1.0e-6f));
+        }
+    }
+} // namespace
+
+TEST(onnx, model_gru_forward)
+{
+    // Y (3, 1, 2, 2), Y_h (1, 2, 2)
+    gru_forward_check("onnx/gru_fwd.onnx",
+                      {{0.219088f, 0.164715f, 0.214130f, 0.338666f, 0.201773f, 0.306861f,
+                        -0.122638f, -0.194812f, 0.086728f, -0.065255f, 0.157385f, 0.242167f},
+                       {0.086728f, -0.065255f, 0.157385f, 0.242167f}});
+}
+
+TEST(onnx, model_gru_forward_linear_before_reset)
+{
+    // Y (3, 1, 2, 2), Y_h (1, 2, 2)
+    gru_forward_check("onnx/gru_fwd_linear_before_reset.onnx",
+                      {{0.197884f, 0.104402f, 0.199230f, 0.312671f, 0.180256f, 0.227559f,
+                        -0.133304f, -0.239837f, 0.085150f, -0.144513f, 0.132578f, 0.184712f},
+                       {0.085150f, -0.144513f, 0.132578f, 0.184712f}});
+}
+
+TEST(onnx, model_rnn_reverse_relu_clip)
+{
+    Model model{onnx_import::load_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/rnn_reverse_relu_clip.onnx"))};
+
+    // X (3, 1, 2)
+    Inputs inputs{{0.280269f, 0.832760f, 0.993591f, 0.687122f, 0.057487f, -0.599184f}};
+
+    // Y (3, 1, 1, 3), Y_h (1, 1, 3)
+    Outputs expected_outputs{
+        {0.5f, 0.f, 0.f, 0.5f, 0.f, 0.f, 0.f, 0.f, 0.285091f}, {0.5f, 0.f, 0.f}};
+
+    ASSERT_EQ(model.size(), expected_outputs.size());
+    for (std::size_t i = 0; i < expected_outputs.size(); ++i)
+    {
+        Outputs outputs{execute(model[i], inputs, "INTERPRETER")};
+        EXPECT_TRUE(test::all_close(expected_outputs[i], outputs.front(), 1.0e-4f, 1.0e-6f));
+    }
+}
@@ -14,11 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdint>
 #include <cstring>
 
 #include <gtest/gtest.h>
 #include <onnxifi.h>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 
 const constexpr std::size_t g_backend_ids_count{10};
@@ -66,3 +68,134 @@ TEST(onnxifi, get_backend_ids_consistency_check)
     EXPECT_TRUE(first_count == second_count);
     EXPECT_TRUE(std::memcmp(first_ids, second_ids, first_count) == 0);
 }
+
+namespace
+{
+    ::onnxTensorDescriptorV1
+        make_descriptor(const char* name, const std::uint64_t* shape, float* data)
+    {
+        ::onnxTensorDescriptorV1 descriptor;
+        descriptor.tag = ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1;
+        descriptor.name = name;
+        descriptor.dataType = ONNXIFI_DATATYPE_FLOAT32;
+        descriptor.memoryType = ONNXIFI_MEMORY_TYPE_CPU;
+        descriptor.dimensions = 1;
+        descriptor.shape = shape;
+        descriptor.buffer = reinterpret_cast<::onnxPointer>(data);
+        return descriptor;
+    }
+
+    ::onnxMemoryFenceV1 make_fence(::onnxEnum type)
+    {
+        ::onnxMemoryFenceV1 fence;
+        fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+        fence.type = type;
+        fence.event = nullptr;
+        return fence;
+    }
+}
+
+TEST(onnxifi, run_graph)
+{
+    ::onnxBackendID backend_ids[g_backend_ids_count];
+    std::size_t count{g_backend_ids_count};
+    ASSERT_TRUE(::onnxGetBackendIDs(backend_ids, &count) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(backend_ids[0], nullptr, &backend) == ONNXIFI_STATUS_SUCCESS);
+
+    auto model = ngraph::file_util::read_file_contents(
+        ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.onnx"));
+    ::onnxGraph graph;
+    ASSERT_TRUE(::onnxInitGraph(backend, nullptr, model.size(), model.data(), 0, nullptr, &graph) ==
+                ONNXIFI_STATUS_SUCCESS);
+
+    const std::uint64_t shape[]{1};
+    float a{1}, b{2}, c{3}, y{0};
+    ::onnxTensorDescriptorV1 inputs[]{make_descriptor("A", shape, &a),
+                                      make_descriptor("B", shape, &b),
+                                      make_descriptor("C", shape, &c)};
+    ::onnxTensorDescriptorV1 output{make_descriptor("Y", shape, &y)};
+    ASSERT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, &output) == ONNXIFI_STATUS_SUCCESS);
+
+    ::onnxMemoryFenceV1 input_fence{make_fence(ONNXIFI_SYNCHRONIZATION_IMPLICIT)};
+    ::onnxMemoryFenceV1 output_fence{make_fence(ONNXIFI_SYNCHRONIZATION_EVENT)};
+    ASSERT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_EQ(y, 6);
+    EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+
+    // Bound buffers are used in place, so new input values are picked up by the next run
+    a = 10;
+    ASSERT_TRUE(::onnxInitEvent(backend, &input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    input_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+    EXPECT_TRUE(::onnxSignalEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(input_fence.event) == ONNXIFI_STATUS_INVALID_STATE);
+    ASSERT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_EQ(y, 15);
+    EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, set_graph_io_errors)
+{
+    ::onnxBackendID backend_ids[g_backend_ids_count];
+    std::size_t count{g_backend_ids_count};
+    ASSERT_TRUE(::onnxGetBackendIDs(backend_ids, &count) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(backend_ids[0], nullptr, &backend) == ONNXIFI_STATUS_SUCCESS);
+
+    auto model = ngraph::file_util::read_file_contents(
+        ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.onnx"));
+    ::onnxGraph graph;
+    ASSERT_TRUE(::onnxInitGraph(backend, nullptr, model.size(), model.data(), 0, nullptr, &graph) ==
+                ONNXIFI_STATUS_SUCCESS);
+
+    const std::uint64_t shape[]{1};
+    const std::uint64_t wrong_shape[]{2};
+    float a{1}, b{2}, c{3}, y{0};
+    ::onnxTensorDescriptorV1 inputs[]{make_descriptor("A", shape, &a),
+                                      make_descriptor("B", shape, &b),
+                                      make_descriptor("D", shape, &c)};
+    ::onnxTensorDescriptorV1 output{make_descriptor("Y", shape, &y)};
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, &output) ==
+                ONNXIFI_STATUS_UNIDENTIFIED_NAME);
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 2, inputs, 1, &output) ==
+                ONNXIFI_STATUS_UNIDENTIFIED_NAME);
+    inputs[2] = make_descriptor("C", wrong_shape, &c);
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, &output) ==
+                ONNXIFI_STATUS_MISMATCHING_SHAPE);
+
+    // Nothing is bound yet, so the graph cannot run
+    ::onnxMemoryFenceV1 input_fence{make_fence(ONNXIFI_SYNCHRONIZATION_IMPLICIT)};
+    ::onnxMemoryFenceV1 output_fence{make_fence(ONNXIFI_SYNCHRONIZATION_IMPLICIT)};
+    EXPECT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) ==
+                ONNXIFI_STATUS_INVALID_STATE);
+
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_INVALID_BACKEND);
+}
+
+TEST(onnxifi, init_backend_twice)
+{
+    ::onnxBackendID backend_ids[g_backend_ids_count];
+    std::size_t count{g_backend_ids_count};
+    ASSERT_TRUE(::onnxGetBackendIDs(backend_ids, &count) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxBackend first, second;
+    ASSERT_TRUE(::onnxInitBackend(backend_ids[0], nullptr, &first) == ONNXIFI_STATUS_SUCCESS);
+    ASSERT_TRUE(::onnxInitBackend(backend_ids[0], nullptr, &second) == ONNXIFI_STATUS_SUCCESS);
+
+    // Releasing one initialization leaves the other usable
+    EXPECT_TRUE(::onnxReleaseBackend(first) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxEvent event;
+    ASSERT_TRUE(::onnxInitEvent(second, &event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(event) == ONNXIFI_STATUS_SUCCESS);
+
+    EXPECT_TRUE(::onnxReleaseBackend(second) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxInitEvent(second, &event) == ONNXIFI_STATUS_INVALID_BACKEND);
+    EXPECT_TRUE(::onnxReleaseBackend(second) == ONNXIFI_STATUS_INVALID_BACKEND);
+}
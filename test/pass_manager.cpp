@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -24,6 +25,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -59,3 +61,24 @@ TEST(pass_manager, module_add_function)
                                        make_shared<op::FunctionCall>(f, NodeVector{X, Y, Z}),
                                    op::ParameterVector{X, Y, Z});
 }
+
+TEST(pass_manager, profile)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto identity = make_shared<op::Reshape>(A, AxisVector{0, 1}, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(identity), op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.set_pass_profiling(true);
+    pass_manager.run_passes(f);
+
+    auto& profile = pass_manager.get_pass_profile();
+    ASSERT_EQ(profile.size(), 1);
+    EXPECT_EQ(profile[0].name, "ngraph::pass::ReshapeElimination");
+    EXPECT_EQ(profile[0].nodes_before, 4);
+    EXPECT_EQ(profile[0].nodes_after, 3);
+    EXPECT_EQ(profile[0].matchers_fired, (map<string, size_t>{{"Unnamed(Reshape)", 1}}));
+    EXPECT_NE(pass::pass_profile_to_json(profile).find("\"nodes_after\": 3"), string::npos);
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -236,3 +237,116 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_planner, greedy_by_size)
+{
+    pass::MemoryPlanner planner{1};
+
+    // First-fit in step order leaves a hole that c does not fit in and needs 40 bytes
+    size_t a = planner.add_buffer(10, 0, 0);
+    size_t b = planner.add_buffer(10, 0, 2);
+    size_t c = planner.add_buffer(20, 1, 2);
+
+    EXPECT_EQ(30, planner.plan());
+    EXPECT_EQ(0, planner.get_offset(c));
+    EXPECT_EQ(0, planner.get_offset(a));
+    EXPECT_EQ(20, planner.get_offset(b));
+    EXPECT_EQ(30, planner.max_allocated());
+    EXPECT_EQ(30, planner.lower_bound());
+}
+
+TEST(memory_planner, shared_buffer)
+{
+    pass::MemoryPlanner planner{8};
+
+    size_t a = planner.add_buffer(4, 0, 1);
+    planner.extend_buffer(a, 12, 3);
+    size_t b = planner.add_buffer(8, 3, 4);
+    size_t c = planner.add_buffer(8, 4, 5);
+
+    EXPECT_EQ(24, planner.plan());
+    EXPECT_EQ(0, planner.get_offset(a));
+    EXPECT_EQ(16, planner.get_offset(b));
+    EXPECT_EQ(0, planner.get_offset(c));
+    EXPECT_EQ(24, planner.lower_bound());
+}
+
+TEST(memory_layout, offline_planning)
+{
+    auto online = make_shared<pass::MemoryLayout>();
+    auto offline = make_shared<pass::MemoryLayout>(1, false, true);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+
+    online->run_on_function(graph);
+    EXPECT_EQ(12, online->get_pool_size());
+
+    offline->run_on_function(graph);
+    EXPECT_EQ(graph->get_temporary_pool_size(), offline->get_pool_size());
+    EXPECT_LE(offline->get_pool_size(), online->get_pool_size());
+    EXPECT_LE(offline->get_lower_bound(), offline->get_pool_size());
+    EXPECT_EQ(online->get_lower_bound(), offline->get_lower_bound());
+
+    // Tensors live at the same time do not share memory
+    vector<descriptor::Tensor*> live;
+    for (auto node : graph->get_ordered_ops())
+    {
+        for (auto tensor : node->liveness_new_list)
+        {
+            for (auto other : live)
+            {
+                EXPECT_TRUE(tensor->get_pool_offset() + tensor->size() <=
+                                other->get_pool_offset() ||
+                            other->get_pool_offset() + other->size() <= tensor->get_pool_offset());
+            }
+            live.push_back(tensor);
+        }
+        for (auto tensor : node->liveness_free_list)
+        {
+            live.erase(find(live.begin(), live.end(), tensor));
+        }
+    }
+}
+
+TEST(memory_layout, offline_planning_limit)
+{
+    // Too many tensors for the planner, laid out first-fit instead
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> chain = A;
+    for (size_t i = 0; i <= pass::MemoryLayout::s_max_planned_tensors; i++)
+    {
+        chain = (i % 2 == 0 ? chain + A : chain * A);
+    }
+    auto f = make_shared<Function>(chain, op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(f);
+
+    pass::MemoryLayout online;
+    online.run_on_function(f);
+    vector<size_t> offsets;
+    for (auto node : f->get_ordered_ops())
+    {
+        for (auto tensor : node->liveness_new_list)
+        {
+            offsets.push_back(tensor->get_pool_offset());
+        }
+    }
+
+    pass::MemoryLayout offline(1, false, true);
+    offline.run_on_function(f);
+    EXPECT_EQ(online.get_pool_size(), offline.get_pool_size());
+    size_t i = 0;
+    for (auto node : f->get_ordered_ops())
+    {
+        for (auto tensor : node->liveness_new_list)
+        {
+            EXPECT_EQ(offsets.at(i++), tensor->get_pool_offset());
+        }
+    }
+}
@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Two branches that each broadcast the parameter to a large tensor and reduce it again
+static shared_ptr<Function> make_branches(NodeVector& broadcasts, NodeVector& sums)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto broadcast = make_shared<op::Broadcast>(A, Shape{2, 1000}, AxisSet{1});
+        broadcasts.push_back(broadcast);
+        sums.push_back(make_shared<op::Sum>(broadcast, AxisSet{1}));
+    }
+    return make_shared<Function>(sums[0] + sums[1], op::ParameterVector{A});
+}
+
+static size_t position(const list<shared_ptr<Node>>& ops, const shared_ptr<Node>& node)
+{
+    return distance(ops.begin(), find(ops.begin(), ops.end(), node));
+}
+
+TEST(memory_schedule, reduce_peak)
+{
+    NodeVector broadcasts, sums;
+    auto f = make_branches(broadcasts, sums);
+    ASSERT_LT(position(f->get_ordered_ops(), broadcasts[1]),
+              position(f->get_ordered_ops(), sums[0]));
+
+    auto schedule = make_shared<pass::MemorySchedule>();
+    schedule->run_on_function(f);
+    EXPECT_EQ(2 * 8000 + 8, schedule->get_original_peak());
+    EXPECT_EQ(8000 + 2 * 8, schedule->get_peak());
+    EXPECT_EQ(schedule->get_peak(), pass::MemorySchedule::get_peak(f->get_ordered_ops()));
+
+    // The first branch is reduced before the second broadcast allocates its output
+    auto ops = f->get_ordered_ops();
+    EXPECT_LT(position(ops, sums[0]), position(ops, broadcasts[1]));
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(8000 + 8 + 8, f->get_temporary_pool_size());
+}
+
+TEST(memory_schedule, rewrite_drops_order)
+{
+    NodeVector broadcasts, sums;
+    auto f = make_branches(broadcasts, sums);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemorySchedule>();
+    pass_manager.run_passes(f);
+    auto ops = f->get_ordered_ops();
+    EXPECT_LT(position(ops, sums[0]), position(ops, broadcasts[1]));
+
+    auto replacement =
+        make_shared<op::Negative>(make_shared<op::Sum>(broadcasts[0], AxisSet{1}));
+    f->replace_node(sums[0], replacement);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(f->get_ops().size(), ops.size());
+    EXPECT_EQ(ops.end(), find(ops.begin(), ops.end(), sums[0]));
+    EXPECT_LT(position(ops, replacement->get_argument(0)), position(ops, replacement));
+}
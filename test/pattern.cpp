@@ -763,6 +763,123 @@ TEST(pattern, recurrent_graph_rewrite)
     }
 }
 
+TEST(pattern, recurrent_graph_rewrite_worklist)
+{
+    Shape shape{};
+    // Counts the nodes offered to the matcher through the arguments its constant label is
+    // tried against
+    auto offered_args = make_shared<map<Node*, size_t>>();
+    auto make_pass = [offered_args, shape]() {
+        auto iconst0 = construct_constant_node(0);
+        auto iconst_label = make_shared<pattern::op::Label>(
+            iconst0,
+            [offered_args](shared_ptr<Node> n) {
+                (*offered_args)[n.get()]++;
+                return true;
+            },
+            NodeVector{iconst0});
+        auto rpattern = make_shared<pattern::op::Label>(element::i32, shape);
+        auto callback = [rpattern](pattern::RecurrentMatcher& rm) {
+            auto seed = rm.get_bound_nodes_for_pattern(rpattern).back();
+            ngraph::replace_node(rm.get_match_root(), seed);
+            return true;
+        };
+        auto pass = make_shared<pass::RecurrentGraphRewrite>();
+        pass->add_matcher(make_shared<pattern::RecurrentMatcher>(
+            iconst_label + rpattern, rpattern, set<shared_ptr<pattern::op::Label>>{}, callback));
+        return pass;
+    };
+
+    auto q1 = make_shared<op::Parameter>(element::i32, shape);
+    auto q2 = make_shared<op::Parameter>(element::i32, shape);
+    auto u = q1 + q2;
+    make_pass()->run_on_function(make_shared<Function>(u, op::ParameterVector{q1, q2}));
+    size_t offers_per_sweep = (*offered_args)[q1.get()];
+    ASSERT_GT(offers_per_sweep, 0);
+    offered_args->clear();
+
+    // Every chain below depends on u, which is offered before any of them and is not touched
+    // by their rewrites, so the sweeps after the first skip it
+    NodeVector results;
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto negative = make_shared<op::Negative>(u);
+        results.push_back(make_shared<op::Abs>(negative + construct_constant_node(0)));
+    }
+    auto f = make_shared<Function>(results, op::ParameterVector{q1, q2});
+    EXPECT_TRUE(make_pass()->run_on_function(f));
+
+    for (auto& result : results)
+    {
+        EXPECT_TRUE(dynamic_pointer_cast<op::Negative>(result->get_argument(0)));
+    }
+    EXPECT_EQ((*offered_args)[q1.get()], offers_per_sweep);
+}
+
+TEST(pattern, recurrent_graph_rewrite_replaced_users)
+{
+    Shape shape{};
+    auto make_matcher = [](const shared_ptr<Node>& pattern,
+                           const shared_ptr<pattern::op::Label>& rpattern) {
+        auto callback = [rpattern](pattern::RecurrentMatcher& rm) {
+            auto seed = rm.get_bound_nodes_for_pattern(rpattern).back();
+            ngraph::replace_node(rm.get_match_root(), seed);
+            return true;
+        };
+        return make_shared<pattern::RecurrentMatcher>(
+            pattern, rpattern, set<shared_ptr<pattern::op::Label>>{}, callback);
+    };
+    auto iconst0 = construct_constant_node(0);
+    auto iconst_label = make_shared<pattern::op::Label>(iconst0, nullptr, NodeVector{iconst0});
+    auto add_seed = make_shared<pattern::op::Label>(element::i32, shape);
+    auto negative_seed = make_shared<pattern::op::Label>(element::i32, shape);
+    pass::RecurrentGraphRewrite rewrite;
+    rewrite.add_matcher(make_matcher(iconst_label + add_seed, add_seed));
+    rewrite.add_matcher(make_matcher(
+        make_shared<op::Negative>(make_shared<op::Negative>(negative_seed)), negative_seed));
+
+    // The outer Negative is offered before the Add below it. Only once the Add is replaced by
+    // the existing inner Negative do the two Negatives form a match.
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto inner = make_shared<op::Negative>(a);
+    auto outer = make_shared<op::Negative>(construct_constant_node(0) + inner);
+    auto abs = make_shared<op::Abs>(outer);
+    auto f = make_shared<Function>(abs, op::ParameterVector{a});
+    EXPECT_TRUE(rewrite.run_on_function(f));
+    EXPECT_EQ(abs->get_argument(0), a);
+}
+
+TEST(pattern, graph_rewrite_matcher_order)
+{
+    Shape shape{2};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(a);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(NodeVector{abs}, op::ParameterVector{a});
+
+    // a matcher rooted at a Label has to be offered every node, in registration order
+    // relative to the matchers rooted at a specific op
+    vector<string> seen;
+    auto abs_pattern = make_shared<op::Abs>(make_shared<pattern::op::Label>(element::f32, shape));
+    auto typed_callback = [&seen](pattern::Matcher& m) {
+        seen.push_back("typed " + m.get_match_root()->description());
+        return false;
+    };
+    auto unary = make_shared<pattern::op::Label>(element::f32, shape, [](shared_ptr<Node> n) {
+        return std::dynamic_pointer_cast<op::Negative>(n) || std::dynamic_pointer_cast<op::Abs>(n);
+    });
+    auto label_callback = [&seen](pattern::Matcher& m) {
+        seen.push_back("label " + m.get_match_root()->description());
+        return false;
+    };
+
+    pass::GraphRewrite rewrite;
+    rewrite.add_matcher(make_shared<pattern::Matcher>(abs_pattern, typed_callback));
+    rewrite.add_matcher(make_shared<pattern::Matcher>(unary, label_callback));
+    rewrite.run_on_function(f);
+    EXPECT_EQ(seen, (vector<string>{"label Negative", "typed Abs", "label Abs"}));
+}
+
 TEST(pattern, label_on_skip)
 {
     Shape shape{2, 2};
@@ -15,10 +15,12 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <map>
 #include <sstream>
 
 #include "gtest/gtest.h"
 
+#include "ngraph/constant_store.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/serializer.hpp"
@@ -103,6 +105,36 @@ TEST(serialize, main)
     backend->call_with_validate(sfunc, {result}, {x, z, y});
     EXPECT_EQ((vector<float>{200, 288, 392, 512}), read_vector<float>(result));
 }
+
+TEST(serialize, binary)
+{
+    // "f(A,B) = (A+B)*C" with a constant C, called twice by g
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B}, "f");
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto Y = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::FunctionCall>(f, NodeVector{X, Y}) +
+                                       make_shared<op::FunctionCall>(f, NodeVector{Y, Y}),
+                                   op::ParameterVector{X, Y},
+                                   "g");
+
+    stringstream ss;
+    serialize_binary(ss, g);
+    shared_ptr<Function> sfunc = deserialize(ss);
+    ASSERT_NE(sfunc, nullptr);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto x = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 2, 3, 4});
+    auto y = backend->create_tensor(element::f32, shape);
+    copy_data(y, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+    backend->call_with_validate(sfunc, {result}, {x, y});
+    EXPECT_EQ((vector<float>{16, 40, 72, 112}), read_vector<float>(result));
+}
 #endif
 
 TEST(serialize, existing_models)
@@ -120,6 +152,39 @@ TEST(serialize, existing_models)
     }
 }
 
+TEST(serialize, existing_models_binary)
+{
+    vector<string> models = {"mxnet/mnist_mlp_forward.json", "mxnet/LSTM_backward.json"};
+
+    auto op_counts = [](shared_ptr<Function> f) {
+        map<string, size_t> counts;
+        for (auto& node : f->get_ops())
+        {
+            stringstream key;
+            key << node->description();
+            for (size_t i = 0; i < node->get_output_size(); i++)
+            {
+                key << " " << node->get_output_element_type(i) << node->get_output_shape(i);
+            }
+            counts[key.str()]++;
+        }
+        return counts;
+    };
+
+    for (const string& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        shared_ptr<Function> f = ngraph::deserialize(file_util::read_file_to_string(json_path));
+        stringstream ss;
+        serialize_binary(ss, f);
+        shared_ptr<Function> g = deserialize(ss);
+        ASSERT_NE(g, nullptr);
+        EXPECT_EQ(op_counts(f), op_counts(g));
+        EXPECT_EQ(f->get_parameters().size(), g->get_parameters().size());
+        EXPECT_EQ(f->get_output_size(), g->get_output_size());
+    }
+}
+
 TEST(serialize, default_value)
 {
     json j = {{"test1", 1}, {"test2", 2}};
@@ -158,6 +223,52 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_mapped)
+{
+    const string tmp_file = file_util::tmp_filename(".cpio");
+    auto A = op::Constant::create(element::i8, Shape{3}, {1, 2, 3});
+    auto B = op::Constant::create(element::f32, Shape{2, 2}, {1.5, 2.5, 3.5, 4.5});
+    auto C = op::Constant::create(element::f64, Shape{2}, {7, 8});
+    auto f = make_shared<Function>(NodeVector{A, B, C}, op::ParameterVector{});
+    serialize(tmp_file, f);
+
+    shared_ptr<Function> streamed;
+    {
+        ifstream in(tmp_file, ios_base::binary | ios_base::in);
+        streamed = deserialize(in);
+    }
+    auto mapped = deserialize(tmp_file);
+    // the mapping outlives the file
+    file_util::remove_file(tmp_file);
+
+    for (auto g : {streamed, mapped})
+    {
+        ASSERT_NE(g, nullptr);
+        auto a = dynamic_pointer_cast<op::Constant>(g->get_results().at(0)->get_argument(0));
+        auto b = dynamic_pointer_cast<op::Constant>(g->get_results().at(1)->get_argument(0));
+        auto c = dynamic_pointer_cast<op::Constant>(g->get_results().at(2)->get_argument(0));
+        ASSERT_TRUE(a && b && c);
+        EXPECT_EQ((vector<int8_t>{1, 2, 3}), a->get_vector<int8_t>());
+        EXPECT_EQ((vector<float>{1.5, 2.5, 3.5, 4.5}), b->get_vector<float>());
+        EXPECT_EQ((vector<double>{7, 8}), c->get_vector<double>());
+        for (auto constant : {a, b, c})
+        {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) %
+                          constant->get_element_type().size(),
+                      0);
+        }
+    }
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto constant =
+            dynamic_pointer_cast<op::Constant>(mapped->get_results().at(i)->get_argument(0));
+        EXPECT_TRUE(constant->get_buffer()->is_mapped());
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) %
+                      ConstantStore::s_alignment,
+                  0);
+    }
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/small_vector.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(small_vector, spill_and_erase)
+{
+    SmallVector<int, 2> v;
+    for (int i = 0; i < 5; i++)
+    {
+        v.push_back(i);
+    }
+    v.push_back(1);
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v.count(1), 2);
+
+    // the last occurrence goes, the order of the rest is kept
+    v.erase(1);
+    EXPECT_EQ(vector<int>(v.begin(), v.end()), (vector<int>{0, 1, 2, 3, 4}));
+    v.erase(7);
+    EXPECT_EQ(v.size(), 5);
+
+    SmallVector<int, 2> w(v);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(w.at(4), 4);
+    EXPECT_THROW(w.at(5), std::out_of_range);
+}
+
+TEST(small_vector, stable_addresses)
+{
+    StableVector<unique_ptr<int>, 1> v;
+    vector<unique_ptr<int>*> addresses;
+    for (int i = 0; i < 4; i++)
+    {
+        addresses.push_back(&v.emplace_back(new int(i)));
+    }
+    EXPECT_EQ(v.size(), 4);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(&v.at(i), addresses[i]);
+        EXPECT_EQ(*v[i], i);
+    }
+    EXPECT_EQ(v.end() - v.begin(), 4);
+}
+
+TEST(small_vector, node_users)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto add = make_shared<op::Add>(A, A);
+    auto mul = make_shared<op::Multiply>(add, B);
+    auto neg = make_shared<op::Negative>(add);
+
+    EXPECT_EQ(A->get_output_inputs(0).size(), 2);
+    EXPECT_EQ(add->get_users(), (NodeVector{mul, neg}));
+    EXPECT_EQ(mul->get_arguments(), (NodeVector{add, B}));
+
+    auto sub = make_shared<op::Subtract>(A, B);
+    replace_node(add, sub);
+    add.reset();
+    EXPECT_EQ(A->get_output_inputs(0).size(), 1);
+    EXPECT_EQ(sub->get_users(), (NodeVector{mul, neg}));
+}
@@ -3448,6 +3448,54 @@ TEST(type_prop, conv_invalid_movement_stride_0)
     }
 }
 
+TEST(type_prop, group_conv_deduce)
+{
+    // Deduce type
+    auto param0 = make_shared<op::Parameter>(element::f32, Shape{64, 32, 100, 150});
+    auto param1 = make_shared<op::Parameter>(element::f32, Shape{64, 8, 10, 20});
+    auto conv = make_shared<op::GroupConvolution>(param0,
+                                                  param1,
+                                                  Strides{2, 3},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{0, 1},
+                                                  CoordinateDiff{0, 1},
+                                                  Strides{1, 1},
+                                                  4);
+    EXPECT_EQ(conv->get_element_type(), element::f32);
+    EXPECT_EQ(conv->get_shape(), (Shape{64, 64, 46, 45}));
+    EXPECT_EQ(conv->get_groups(), 4);
+}
+
+TEST(type_prop, group_conv_invalid_groups)
+{
+    // Deduce type
+    auto param0 = make_shared<op::Parameter>(element::f32, Shape{64, 30, 100, 150});
+    auto param1 = make_shared<op::Parameter>(element::f32, Shape{64, 7, 10, 20});
+    try
+    {
+        auto conv = make_shared<op::GroupConvolution>(param0,
+                                                      param1,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{0, 0},
+                                                      CoordinateDiff{0, 0},
+                                                      Strides{1, 1},
+                                                      4);
+
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Channel count not divisible by the number of groups not detected";
+    }
+    catch (const NodeValidationError& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(),
+                             std::string("must both be divisible by the number of groups"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, max_pool_1d_deduce)
 {
     // Deduce type
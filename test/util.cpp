@@ -25,6 +25,7 @@
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
@@ -299,6 +300,92 @@ TEST(graph_util, clone_multiple_results)
     auto copy = clone_function(*f);
 }
 
+TEST(graph_util, specialize_batch)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{4, 2});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Dot>(A, B) + C},
+                                   op::ParameterVector{A, B, C});
+    f->set_batch_axis(0, op::ParameterVector{A, C});
+
+    auto specialized = specialize_batch(*f, 16);
+    EXPECT_EQ(specialized->get_parameters().at(0)->get_shape(), (Shape{16, 3}));
+    EXPECT_EQ(specialized->get_parameters().at(1)->get_shape(), (Shape{3, 2}));
+    EXPECT_EQ(specialized->get_parameters().at(2)->get_shape(), (Shape{16, 2}));
+    EXPECT_EQ(specialized->get_output_shape(0), (Shape{16, 2}));
+    EXPECT_EQ(specialized->get_batch_size(), 16);
+    EXPECT_FALSE(specialized->is_batched_parameter(1));
+
+    // The Reshape fixes the extent of the batch axis
+    auto g = make_shared<Function>(
+        NodeVector{make_shared<op::Reshape>(A, AxisVector{0, 1}, Shape{4, 3, 1})},
+        op::ParameterVector{A});
+    g->set_batch_axis(0);
+    EXPECT_ANY_THROW(specialize_batch(*g, 2));
+}
+
+TEST(graph_util, has_independent_batch_slices)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto make_function = [&](const shared_ptr<Node>& node, size_t axis) {
+        auto f = make_shared<Function>(node, op::ParameterVector{A, B});
+        f->set_batch_axis(axis, op::ParameterVector{A});
+        return f;
+    };
+
+    auto dot = make_shared<op::Dot>(make_shared<op::Relu>(A), B);
+    EXPECT_TRUE(has_independent_batch_slices(*make_function(dot, 0)));
+    EXPECT_TRUE(has_independent_batch_slices(
+        *make_function(make_shared<op::Softmax>(dot, AxisSet{1}), 0)));
+    EXPECT_TRUE(has_independent_batch_slices(
+        *make_function(make_shared<op::Reverse>(A, AxisSet{1}), 0)));
+
+    // Ops that combine the slices of the batch axis
+    EXPECT_FALSE(has_independent_batch_slices(
+        *make_function(make_shared<op::Softmax>(dot, AxisSet{0}), 0)));
+    EXPECT_FALSE(has_independent_batch_slices(
+        *make_function(make_shared<op::Reverse>(A, AxisSet{0}), 0)));
+    auto sum = make_shared<op::Sum>(A, AxisSet{0});
+    EXPECT_FALSE(has_independent_batch_slices(
+        *make_function(make_shared<op::Broadcast>(sum, Shape{4, 3}, AxisSet{0}), 0)));
+}
+
+TEST(util, strided_loop)
+{
+    // Transpose of a {2, 3, 4} tensor to {4, 3, 2}
+    Shape shape{4, 3, 2};
+    runtime::reference::StridedLoop<2> loop(
+        shape, {{vector<size_t>{1, 4, 12}, row_major_strides(shape)}});
+    vector<size_t> in_offsets;
+    vector<size_t> out_offsets;
+    loop([&](const array<size_t, 2>& offsets, size_t count) {
+        for (size_t i = 0; i < count; i++)
+        {
+            in_offsets.push_back(offsets[0] + i * loop.get_inner_stride(0));
+            out_offsets.push_back(offsets[1] + i * loop.get_inner_stride(1));
+        }
+    });
+    ASSERT_EQ(in_offsets.size(), 24);
+    EXPECT_EQ((vector<size_t>{0, 12, 4, 16, 8, 20, 1, 13}),
+              vector<size_t>(in_offsets.begin(), in_offsets.begin() + 8));
+    for (size_t i = 0; i < out_offsets.size(); i++)
+    {
+        EXPECT_EQ(out_offsets[i], i);
+    }
+
+    // Contiguous axes are walked as a single run
+    size_t runs = 0;
+    runtime::reference::StridedLoop<1> contiguous(
+        Shape{2, 1, 3}, {{row_major_strides(Shape{2, 1, 3})}});
+    contiguous([&](const array<size_t, 1>& offsets, size_t count) {
+        EXPECT_EQ(count, 6);
+        runs++;
+    });
+    EXPECT_EQ(runs, 1);
+}
+
 TEST(util, round_up)
 {
     EXPECT_EQ(0, round_up(0, 4));